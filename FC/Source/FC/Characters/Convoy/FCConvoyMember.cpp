@@ -6,6 +6,7 @@
 #include "Components/CapsuleComponent.h"
 #include "Core/FCPlayerController.h"
 #include "Interaction/FCInteractionComponent.h"
+#include "Interaction/FCInteractableDispatch.h"
 #include "Interaction/IFCInteractablePOI.h"
 #include "NavigationSystem.h"
 #include "NavigationPath.h"
@@ -115,8 +116,8 @@ void AFCConvoyMember::OnCapsuleBeginOverlap(
 		return;
 	}
 
-	// Check if actor implements IFCInteractablePOI interface
-	if (OtherActor->GetClass()->ImplementsInterface(UIFCInteractablePOI::StaticClass()))
+	// Check if actor implements IFCInteractablePOI interface (cached per class)
+	if (FFCInteractableDispatch::IsPOI(OtherActor))
 	{
 		UE_LOG(LogFCConvoyMember, Log, TEXT("ConvoyMember %s: Detected overlap with POI %s"),
 			*GetName(), *OtherActor->GetName());
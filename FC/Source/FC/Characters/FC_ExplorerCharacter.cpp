@@ -5,6 +5,7 @@
 #include "Components/CapsuleComponent.h"
 #include "Core/FCPlayerController.h"
 #include "Interaction/FCInteractionComponent.h"
+#include "Interaction/FCInteractableDispatch.h"
 #include "Interaction/IFCInteractablePOI.h"
 #include "NavigationSystem.h"
 #include "NavigationPath.h"
@@ -184,7 +185,7 @@ void AFC_ExplorerCharacter::OnCapsuleBeginOverlap(
         return;
     }
 
-    if (!OtherActor->GetClass()->ImplementsInterface(UIFCInteractablePOI::StaticClass()))
+    if (!FFCInteractableDispatch::IsPOI(OtherActor))
     {
         return;
     }
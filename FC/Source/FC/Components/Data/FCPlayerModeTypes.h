@@ -51,7 +51,7 @@ struct FPlayerModeProfile
 	UPROPERTY(EditDefaultsOnly, Category = "FC|Mode")
 	EFCPlayerCameraMode CameraMode = EFCPlayerCameraMode::FirstPerson;
 
-	/** Placeholder for future mode-specific interaction profile asset/type. */
+	/** Interaction probe for this mode (probe type, range, focus on/off). None = first-person line trace only. */
 	UPROPERTY(EditDefaultsOnly, Category="FC|Mode")
 	TSoftObjectPtr<UFCInteractionProfile> InteractionProfile;
 
@@ -4,6 +4,7 @@
 #include "FCPlayerController.h"
 #include "Components/FCInputManager.h"
 #include "Interaction/FCInteractionComponent.h"
+#include "Interaction/FCInteractionProfile.h"
 #include "Input/FCInputConfig.h"
 
 DEFINE_LOG_CATEGORY(LogFCPlayerModeCoordinator);
@@ -217,8 +218,28 @@ void UFCPlayerModeCoordinator::ApplyMode(EFCPlayerMode NewMode)
 	// 4) Interaction gating (no tick polling)
 	if (UFCInteractionComponent* Interaction = PC->FindComponentByClass<UFCInteractionComponent>())
 	{
-		Interaction->SetFirstPersonFocusEnabled(Profile.CameraMode == EFCPlayerCameraMode::FirstPerson);
-		// Later: Interaction->ApplyModeProfile(Profile); (once we add it)
+		// The mode's interaction profile decides probe type and whether focus runs at all;
+		// modes without one keep the legacy behaviour (first person only, default line trace).
+		UFCInteractionProfile* InteractionProfile = nullptr;
+		if (!Profile.InteractionProfile.IsNull())
+		{
+			InteractionProfile = Profile.InteractionProfile.LoadSynchronous();
+			if (!InteractionProfile)
+			{
+				UE_LOG(LogFCPlayerModeCoordinator, Warning, TEXT("ApplyMode: Failed to load InteractionProfile for %s"),
+					*UEnum::GetValueAsString(NewMode));
+			}
+		}
+
+		Interaction->ApplyInteractionProfile(InteractionProfile);
+		Interaction->SetFocusEnabled(InteractionProfile
+			? InteractionProfile->bDetectFocus
+			: Profile.CameraMode == EFCPlayerCameraMode::FirstPerson);
+
+		UE_LOG(LogFCPlayerModeCoordinator, Log, TEXT("ApplyMode: InteractionProfile=%s Probe=%s Focus=%s"),
+			*GetNameSafe(InteractionProfile),
+			InteractionProfile ? *UEnum::GetValueAsString(InteractionProfile->ProbeType) : TEXT("Default"),
+			(InteractionProfile ? InteractionProfile->bDetectFocus : Profile.CameraMode == EFCPlayerCameraMode::FirstPerson) ? TEXT("On") : TEXT("Off"));
 	}
 }
 
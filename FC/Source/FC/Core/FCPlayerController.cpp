@@ -786,16 +786,24 @@ void AFCPlayerController::DevQuickSave()
 		return;
 	}
 
-	bool bSuccess = GameInstance->SaveGame(TEXT("QuickSave"));
-	if (bSuccess)
+	// The write finishes in the background; report the outcome when it lands on disk.
+	const bool bQueued = GameInstance->SaveGame(TEXT("QuickSave"), FFCOnSaveWriteComplete::CreateWeakLambda(this, [](const FString& SlotName, bool bSuccess)
 	{
 		if (GEngine)
 		{
-			GEngine->AddOnScreenDebugMessage(-1, 3.f, FColor::Green, TEXT("Quick Save successful"));
+			GEngine->AddOnScreenDebugMessage(-1, 3.f, bSuccess ? FColor::Green : FColor::Red, bSuccess ? TEXT("Quick Save successful") : TEXT("Quick Save failed"));
 		}
-		UE_LOG(LogFallenCompassPlayerController, Log, TEXT("DevQuickSave: Save successful"));
-	}
-	else
+		if (bSuccess)
+		{
+			UE_LOG(LogFallenCompassPlayerController, Log, TEXT("DevQuickSave: Save successful"));
+		}
+		else
+		{
+			UE_LOG(LogFallenCompassPlayerController, Error, TEXT("DevQuickSave: Save failed"));
+		}
+	}));
+
+	if (!bQueued)
 	{
 		if (GEngine)
 		{
@@ -816,8 +824,9 @@ void AFCPlayerController::DevQuickLoad()
 		return;
 	}
 
-	// Check if QuickSave exists
-	if (!UGameplayStatics::DoesSaveGameExist(TEXT("QuickSave"), 0))
+	// Check if QuickSave exists (a quicksave still being written counts)
+	UFCSaveManager* SaveManager = GameInstance->GetSubsystem<UFCSaveManager>();
+	if (!SaveManager || !SaveManager->DoesSaveGameExist(TEXT("QuickSave"), 0))
 	{
 		if (GEngine)
 		{
@@ -203,6 +203,7 @@ void UFCTransitionManager::BeginFadeOut(float Duration, bool bShowLoadingIndicat
 	}
 
 	bCurrentlyFading = true;
+	bCurrentlyFadingOut = true;
 	TransitionWidget->BeginFadeOut(Duration, bShowLoadingIndicator);
 
 	UE_LOG(LogFCTransitions, Log, TEXT("FCTransitionManager: Fade out started (Duration: %.2fs, Loading: %s)"),
@@ -233,6 +234,7 @@ void UFCTransitionManager::BeginFadeIn(float Duration)
 	}
 
 	bCurrentlyFading = true;
+	bCurrentlyFadingOut = false;
 	TransitionWidget->BeginFadeIn(Duration);
 
 	UE_LOG(LogFCTransitions, Log, TEXT("FCTransitionManager: Fade in started (Duration: %.2fs)"), Duration);
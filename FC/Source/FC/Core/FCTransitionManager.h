@@ -52,6 +52,12 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Transition")
 	bool IsFading() const { return bCurrentlyFading; }
 
+	/**
+	 * Check if the transition in progress is a fade to black
+	 */
+	UFUNCTION(BlueprintPure, Category = "Transition")
+	bool IsFadingOut() const { return bCurrentlyFading && bCurrentlyFadingOut; }
+
 	/**
 	 * Check if screen is currently black (fully opaque)
 	 * @return True if transition widget exists and is showing black screen
@@ -105,6 +111,11 @@ protected:
 	 */
 	bool bCurrentlyFading;
 
+	/**
+	 * Direction of the transition in progress (valid while bCurrentlyFading)
+	 */
+	bool bCurrentlyFadingOut = false;
+
 	/**
 	 * Name of the currently loaded level (for detecting same-level loads)
 	 */
@@ -3,6 +3,9 @@
 #include "Misc/ConfigCacheIni.h"
 #include "Kismet/GameplayStatics.h"
 #include "SaveGame/FCSaveGame.h"
+#include "SaveGame/FCAutosaveManager.h"
+#include "SaveGame/FCCampaignSnapshot.h"
+#include "Expedition/FCExpeditionManager.h"
 #include "FCPlayerController.h"
 #include "FCFirstPersonCharacter.h"
 #include "FCTransitionManager.h"
@@ -65,7 +68,12 @@ void UFCGameInstance::Shutdown()
         *CurrentExpeditionId,
         bIsSessionDirty ? 1 : 0);
 
-    // Future hook: ensure outstanding meta saves flush before quitting.
+    // Outstanding background saves must reach disk before subsystems go away.
+    if (UFCSaveManager* SaveManager = GetSubsystem<UFCSaveManager>())
+    {
+        SaveManager->FlushPendingWrites();
+    }
+
     Super::Shutdown();
 }
 
@@ -187,6 +195,11 @@ bool UFCGameInstance::ConsumeMoney(int32 Amount)
 }
 
 bool UFCGameInstance::SaveGame(const FString& SlotName)
+{
+    return SaveGame(SlotName, FFCOnSaveWriteComplete());
+}
+
+bool UFCGameInstance::SaveGame(const FString& SlotName, FFCOnSaveWriteComplete OnComplete)
 {
     UE_LOG(LogTemp, Log, TEXT("UFCGameInstance::SaveGame - Saving to slot: %s"), *SlotName);
 
@@ -226,39 +239,210 @@ bool UFCGameInstance::SaveGame(const FString& SlotName)
     SaveGameInstance->DiscoveredRegions = DiscoveredRegions;
     SaveGameInstance->ExpeditionsCounter = ExpeditionsCounter;
 
-    // Save to disk
-    bool bSuccess = UGameplayStatics::SaveGameToSlot(SaveGameInstance, SlotName, 0);
-    if (bSuccess)
+    // Game state, expedition and world map in one chunked snapshot inside the same file
+    FFCCampaignSnapshot Snapshot;
+    WriteGameStateSection(Snapshot, GameStateData);
+    if (UFCExpeditionManager* ExpeditionMgr = GetSubsystem<UFCExpeditionManager>())
     {
-        UE_LOG(LogTemp, Log, TEXT("Successfully saved game to slot: %s"), *SlotName);
-        MarkSessionSaved();
+        ExpeditionMgr->WriteCampaignSections(Snapshot);
     }
-    else
+    Snapshot.Serialize(SaveGameInstance->CampaignSnapshot);
+
+    UFCSaveManager* SaveManager = GetSubsystem<UFCSaveManager>();
+    if (!SaveManager)
+    {
+        UE_LOG(LogTemp, Error, TEXT("SaveGame: SaveManager subsystem not found"));
+        return false;
+    }
+
+    // Menu metadata; the index entry is only written once the save itself is on disk
+    FFCSaveSlotInfo SlotInfo;
+    SlotInfo.SlotName = SlotName;
+    SlotInfo.Timestamp = SaveGameInstance->Timestamp;
+    SlotInfo.LevelName = SaveGameInstance->CurrentLevelName;
+    SlotInfo.GameVersion = SaveGameInstance->GameVersion;
+
+    // Serialize now (the snapshot above), write to disk on a background worker
+    TWeakObjectPtr<UFCGameInstance> WeakThis(this);
+    const bool bQueued = SaveManager->SaveGameToSlotAsync(SaveGameInstance, SlotName, 0,
+        FFCOnSaveWriteComplete::CreateLambda([WeakThis, OnComplete, SlotInfo](const FString& SavedSlotName, bool bSuccess)
+        {
+            if (UFCGameInstance* StrongThis = WeakThis.Get())
+            {
+                if (bSuccess)
+                {
+                    UE_LOG(LogTemp, Log, TEXT("Successfully saved game to slot: %s"), *SavedSlotName);
+                    StrongThis->MarkSessionSaved();
+
+                    if (UFCSaveManager* Manager = StrongThis->GetSubsystem<UFCSaveManager>())
+                    {
+                        Manager->UpdateSlotInfo(SlotInfo);
+                    }
+                }
+                else
+                {
+                    UE_LOG(LogTemp, Error, TEXT("Failed to save game to slot: %s"), *SavedSlotName);
+                }
+                StrongThis->OnGameSaved.Broadcast(SavedSlotName, bSuccess);
+            }
+            OnComplete.ExecuteIfBound(SavedSlotName, bSuccess);
+        }));
+
+    if (!bQueued)
     {
         UE_LOG(LogTemp, Error, TEXT("Failed to save game to slot: %s"), *SlotName);
     }
+    else
+    {
+        SaveManager->CaptureSlotThumbnail(SlotName);
+    }
 
-    return bSuccess;
+    return bQueued;
 }
 
 void UFCGameInstance::LoadGameAsync(const FString& SlotName)
 {
     UE_LOG(LogTemp, Log, TEXT("UFCGameInstance::LoadGameAsync - Loading from slot: %s"), *SlotName);
 
+    UFCSaveManager* SaveManager = GetSubsystem<UFCSaveManager>();
+
     // Check if save exists
-    if (!UGameplayStatics::DoesSaveGameExist(SlotName, 0))
+    if (!SaveManager || !SaveManager->DoesSaveGameExist(SlotName, 0))
     {
         UE_LOG(LogTemp, Error, TEXT("Save slot does not exist: %s"), *SlotName);
-        OnGameLoaded.Broadcast(false);
+        OnGameLoaded.Broadcast(false, FFCSaveLoadTimings());
         return;
     }
 
-    // Load save game object
-    UFCSaveGame* LoadGameInstance = Cast<UFCSaveGame>(UGameplayStatics::LoadGameFromSlot(SlotName, 0));
+    const uint32 RequestId = ++LoadGameRequestId;
+    bLoadGameResultReady = false;
+    bLoadGameFadeOutDone = false;
+    LoadGameSlotName = SlotName;
+    LoadGameTimings = FFCSaveLoadTimings();
+    LoadGameStartTime = FPlatformTime::Seconds();
+    PendingLoadData = nullptr;
+
+    // Fade out (with loading indicator) while the save is read in the background, so the
+    // load latency overlaps the transition instead of stacking on top of it.
+    // A fade already running (e.g. the main menu's fade-in) cannot be replaced: wait for a
+    // fade-out to finish, or start ours once a fade-in has ended.
+    UFCTransitionManager* TransitionMgr = GetSubsystem<UFCTransitionManager>();
+    if (TransitionMgr && TransitionMgr->IsFadingOut())
+    {
+        TransitionMgr->OnFadeOutComplete.AddUniqueDynamic(this, &UFCGameInstance::OnFadeOutCompleteForLoadGame);
+    }
+    else if (TransitionMgr && TransitionMgr->IsFading())
+    {
+        TransitionMgr->OnFadeInComplete.AddUniqueDynamic(this, &UFCGameInstance::OnFadeInCompleteForLoadGame);
+    }
+    else
+    {
+        BeginFadeOutForLoadGame();
+    }
+
+    SaveManager->LoadGameFromSlotAsync(SlotName, 0, FFCOnSaveLoadComplete::CreateUObject(
+        this, &UFCGameInstance::OnSaveLoadedForLoadGame, RequestId, SlotName));
+}
+
+void UFCGameInstance::OnSaveLoadedForLoadGame(USaveGame* LoadedGame, const FFCSaveLoadTimings& Timings, uint32 RequestId, FString SlotName)
+{
+    if (RequestId != LoadGameRequestId)
+    {
+        UE_LOG(LogTemp, Log, TEXT("LoadGameAsync: Dropping result for superseded load of slot %s"), *SlotName);
+        return;
+    }
+
+    // A torn or corrupt autosave falls back to the previous ring entry
+    if (!LoadedGame)
+    {
+        UFCAutosaveManager* AutosaveMgr = GetSubsystem<UFCAutosaveManager>();
+        UFCSaveManager* SaveManager = GetSubsystem<UFCSaveManager>();
+        const FString FallbackSlot = AutosaveMgr ? AutosaveMgr->GetFallbackSlot(SlotName) : FString();
+        if (SaveManager && !FallbackSlot.IsEmpty())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("LoadGameAsync: Slot %s failed to load, falling back to %s"), *SlotName, *FallbackSlot);
+            LoadGameSlotName = FallbackSlot;
+            SaveManager->LoadGameFromSlotAsync(FallbackSlot, 0, FFCOnSaveLoadComplete::CreateUObject(
+                this, &UFCGameInstance::OnSaveLoadedForLoadGame, RequestId, FallbackSlot));
+            return;
+        }
+    }
+
+    PendingLoadData = Cast<UFCSaveGame>(LoadedGame);
+    LoadGameTimings = Timings;
+    bLoadGameResultReady = true;
+
+    UE_LOG(LogTemp, Log, TEXT("LoadGameAsync: Slot %s loaded in background (read %.2f ms, decompress %.2f ms, deserialize %.2f ms, %d bytes)%s"),
+        *SlotName, Timings.ReadMs, Timings.DecompressMs, Timings.DeserializeMs, Timings.FileBytes,
+        bLoadGameFadeOutDone ? TEXT("") : TEXT(" - waiting for fade-out"));
+
+    TryFinishLoadGame();
+}
+
+void UFCGameInstance::BeginFadeOutForLoadGame()
+{
+    UFCTransitionManager* TransitionMgr = GetSubsystem<UFCTransitionManager>();
+    if (TransitionMgr && !TransitionMgr->IsBlack())
+    {
+        TransitionMgr->OnFadeOutComplete.AddUniqueDynamic(this, &UFCGameInstance::OnFadeOutCompleteForLoadGame);
+        TransitionMgr->BeginFadeOut(1.0f, true);
+        if (TransitionMgr->IsFading())
+        {
+            return;
+        }
+        TransitionMgr->OnFadeOutComplete.RemoveDynamic(this, &UFCGameInstance::OnFadeOutCompleteForLoadGame);
+    }
+
+    // No fade to wait for (none available, already black, or the fade could not start)
+    bLoadGameFadeOutDone = true;
+    TryFinishLoadGame();
+}
+
+void UFCGameInstance::OnFadeInCompleteForLoadGame()
+{
+    // Unbind delegate (one-shot callback)
+    if (UFCTransitionManager* TransitionMgr = GetSubsystem<UFCTransitionManager>())
+    {
+        TransitionMgr->OnFadeInComplete.RemoveDynamic(this, &UFCGameInstance::OnFadeInCompleteForLoadGame);
+    }
+
+    BeginFadeOutForLoadGame();
+}
+
+void UFCGameInstance::OnFadeOutCompleteForLoadGame()
+{
+    // Unbind delegate (one-shot callback)
+    if (UFCTransitionManager* TransitionMgr = GetSubsystem<UFCTransitionManager>())
+    {
+        TransitionMgr->OnFadeOutComplete.RemoveDynamic(this, &UFCGameInstance::OnFadeOutCompleteForLoadGame);
+    }
+
+    bLoadGameFadeOutDone = true;
+    TryFinishLoadGame();
+}
+
+void UFCGameInstance::TryFinishLoadGame()
+{
+    if (!bLoadGameResultReady || !bLoadGameFadeOutDone)
+    {
+        return;
+    }
+    bLoadGameResultReady = false;
+
+    UE_LOG(LogTemp, Log, TEXT("LoadGameAsync: Load and fade-out both done %.2f ms after the request (load alone took %.2f ms)"),
+        (FPlatformTime::Seconds() - LoadGameStartTime) * 1000.0, LoadGameTimings.TotalMs);
+
+    UFCTransitionManager* TransitionMgr = GetSubsystem<UFCTransitionManager>();
+
+    UFCSaveGame* LoadGameInstance = PendingLoadData;
     if (!LoadGameInstance)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to load save game object from slot: %s"), *SlotName);
-        OnGameLoaded.Broadcast(false);
+        UE_LOG(LogTemp, Error, TEXT("Failed to load save game object from slot: %s"), *LoadGameSlotName);
+        if (TransitionMgr && TransitionMgr->IsBlack())
+        {
+            TransitionMgr->BeginFadeIn(1.0f);
+        }
+        OnGameLoaded.Broadcast(false, LoadGameTimings);
         return;
     }
 
@@ -267,17 +451,31 @@ void UFCGameInstance::LoadGameAsync(const FString& SlotName)
     DiscoveredRegions = LoadGameInstance->DiscoveredRegions;
     ExpeditionsCounter = LoadGameInstance->ExpeditionsCounter;
 
-    // Cache the save data for position restoration after level load
-    PendingLoadData = LoadGameInstance;
+    // Restore the campaign behind the fade, before the level opens or the position is restored
+    FFCCampaignSnapshot Snapshot;
+    if (LoadGameInstance->CampaignSnapshot.Num() > 0 && Snapshot.Parse(MoveTemp(LoadGameInstance->CampaignSnapshot)))
+    {
+        if (!ReadGameStateSection(Snapshot, GameStateData))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("LoadGameAsync: Game state section missing or unreadable; keeping current values"));
+        }
+        if (UFCExpeditionManager* ExpeditionManager = GetSubsystem<UFCExpeditionManager>())
+        {
+            ExpeditionManager->RestoreCampaignSections(Snapshot);
+        }
+    }
+    else
+    {
+        UE_LOG(LogTemp, Log, TEXT("LoadGameAsync: Slot %s has no campaign snapshot (older save); keeping current campaign state"), *LoadGameSlotName);
+    }
 
-    // Get level manager and transition manager
+    // Get level manager
     UFCLevelManager* LevelMgr = GetSubsystem<UFCLevelManager>();
-    UFCTransitionManager* TransitionMgr = GetSubsystem<UFCTransitionManager>();
-    
     if (!LevelMgr)
     {
         UE_LOG(LogTemp, Error, TEXT("LoadGameAsync: LevelManager subsystem not found"));
-        OnGameLoaded.Broadcast(false);
+        PendingLoadData = nullptr;
+        OnGameLoaded.Broadcast(false, LoadGameTimings);
         return;
     }
 
@@ -288,104 +486,89 @@ void UFCGameInstance::LoadGameAsync(const FString& SlotName)
 
     if (!bIsSameLevel && !TargetLevelFName.IsNone())
     {
-        // Cross-level load - use fade transition
+        // Cross-level load - the screen is already black, open the level right away
         UE_LOG(LogTemp, Log, TEXT("Loading different level: %s (cross-level fade transition)"), *TargetLevelFName.ToString());
-        
-        if (TransitionMgr)
-        {
-            // Fade out with loading indicator
-            TransitionMgr->BeginFadeOut(1.0f, true);
-            
-            // Store target level for deferred load
-            PendingLevelLoad = TargetLevelFName;
-            
-            // Use timer to load level after fade completes (1.2s gives time for 1.0s fade)
-            GetWorld()->GetTimerManager().SetTimer(
-                LevelLoadTimerHandle,
-                [this, TargetLevelFName]()
-                {
-                    UGameplayStatics::OpenLevel(GetWorld(), TargetLevelFName);
-                },
-                1.2f,
-                false
-            );
-        }
-        else
-        {
-            // Fallback: immediate load
-            UGameplayStatics::OpenLevel(GetWorld(), TargetLevelFName);
-        }
+        PendingLevelLoad = TargetLevelFName;
+        UGameplayStatics::OpenLevel(GetWorld(), TargetLevelFName);
     }
     else
     {
-        // Same level - restore position immediately
+        // Same level - restore position behind the fade, then reveal
         UE_LOG(LogTemp, Log, TEXT("Same level (%s), restoring player position immediately"), *CurrentLevelName.ToString());
         RestorePlayerPosition();
+        if (TransitionMgr && TransitionMgr->IsBlack())
+        {
+            TransitionMgr->BeginFadeIn(1.0f);
+        }
     }
 
-    UE_LOG(LogTemp, Log, TEXT("Successfully loaded game from slot: %s"), *SlotName);
-    OnGameLoaded.Broadcast(true);
+    UE_LOG(LogTemp, Log, TEXT("Successfully loaded game from slot: %s"), *LoadGameSlotName);
+    OnGameLoaded.Broadcast(true, LoadGameTimings);
 }
 
 TArray<FString> UFCGameInstance::GetAvailableSaveSlots()
 {
     TArray<FString> SaveSlots;
 
-    // Check for auto saves
-    for (int32 i = 1; i <= 3; ++i)
+    UFCSaveManager* SaveManager = GetSubsystem<UFCSaveManager>();
+    if (!SaveManager)
     {
-        FString SlotName = FString::Printf(TEXT("AutoSave_%03d"), i);
-        if (UGameplayStatics::DoesSaveGameExist(SlotName, 0))
-        {
-            SaveSlots.Add(SlotName);
-            UE_LOG(LogTemp, Log, TEXT("GetAvailableSaveSlots: Found %s"), *SlotName);
-        }
+        return SaveSlots;
     }
 
-    // Check for quick save
-    if (UGameplayStatics::DoesSaveGameExist(TEXT("QuickSave"), 0))
+    for (const FFCSaveSlotInfo& Info : SaveManager->GetSlotInfos())
     {
-        SaveSlots.Add(TEXT("QuickSave"));
-        UE_LOG(LogTemp, Log, TEXT("GetAvailableSaveSlots: Found QuickSave"));
-    }
-
-    // Check for manual saves (up to 10 for now)
-    for (int32 i = 1; i <= 10; ++i)
-    {
-        FString SlotName = FString::Printf(TEXT("Manual_%03d"), i);
-        if (UGameplayStatics::DoesSaveGameExist(SlotName, 0))
-        {
-            SaveSlots.Add(SlotName);
-            UE_LOG(LogTemp, Log, TEXT("GetAvailableSaveSlots: Found %s"), *SlotName);
-        }
+        SaveSlots.Add(Info.SlotName);
     }
 
     UE_LOG(LogTemp, Log, TEXT("GetAvailableSaveSlots: Total found: %d"), SaveSlots.Num());
     return SaveSlots;
 }
 
+TArray<FFCSaveSlotInfo> UFCGameInstance::GetSaveSlotInfos()
+{
+    UFCSaveManager* SaveManager = GetSubsystem<UFCSaveManager>();
+    return SaveManager ? SaveManager->GetSlotInfos() : TArray<FFCSaveSlotInfo>();
+}
+
 FString UFCGameInstance::GetMostRecentSave()
 {
-    TArray<FString> SaveSlots = GetAvailableSaveSlots();
-    if (SaveSlots.Num() == 0)
-    {
-        return TEXT("");
-    }
+    UFCSaveManager* SaveManager = GetSubsystem<UFCSaveManager>();
+    return SaveManager ? SaveManager->GetMostRecentSlot() : FString();
+}
 
-    FString MostRecentSlot;
-    FDateTime MostRecentTime = FDateTime::MinValue();
+void UFCGameInstance::WriteGameStateSection(FFCCampaignSnapshot& Snapshot, const FFCGameStateData& Data)
+{
+    FFCGameStateData Copy = Data;
+    Snapshot.AddSection(FCCampaignSection::GameState, 1, [&Copy](FArchive& Ar)
+    {
+        Ar << Copy.Supplies;
+        Ar << Copy.Money;
+        Ar << Copy.Day;
+    });
+}
 
-    for (const FString& SlotName : SaveSlots)
+bool UFCGameInstance::ReadGameStateSection(const FFCCampaignSnapshot& Snapshot, FFCGameStateData& OutData)
+{
+    FFCGameStateData Data;
+    bool bKnownVersion = true;
+    const bool bRead = Snapshot.ReadSection(FCCampaignSection::GameState, [&Data, &bKnownVersion](FArchive& Ar, uint16 Version)
     {
-        UFCSaveGame* SaveGame = Cast<UFCSaveGame>(UGameplayStatics::LoadGameFromSlot(SlotName, 0));
-        if (SaveGame && SaveGame->Timestamp > MostRecentTime)
+        bKnownVersion = Version == 1;
+        if (bKnownVersion)
         {
-            MostRecentTime = SaveGame->Timestamp;
-            MostRecentSlot = SlotName;
+            Ar << Data.Supplies;
+            Ar << Data.Money;
+            Ar << Data.Day;
         }
-    }
+    });
 
-    return MostRecentSlot;
+    if (!bRead || !bKnownVersion)
+    {
+        return false;
+    }
+    OutData = Data;
+    return true;
 }
 
 void UFCGameInstance::RestorePlayerPosition()
@@ -3,9 +3,13 @@
 #include "CoreMinimal.h"
 #include "Engine/DataTable.h"
 #include "Engine/GameInstance.h"
+#include "Expedition/FCRouteRiskSimulator.h"
+#include "SaveGame/FCSaveManager.h"
 #include "UFCGameInstance.generated.h"
 
 class UFCSaveGame;
+class FFCCampaignSnapshot;
+class UFCWorldMapTerrainCostTable;
 
 /**
  * FFCGameStateData
@@ -119,6 +123,21 @@ class FC_API UFCGameInstance : public UGameInstance
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Expedition|WorldMap")
     TSoftObjectPtr<UTexture2D> WorldMapLandMaskTexture;
 
+    /**
+     * Optional terrain-class layer for the world map (256x256, uncompressed G8 or BGRA8).
+     * Each texel value is a row of WorldMapTerrainCosts. When unset, land is class 0 and water is class 1.
+     */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Expedition|WorldMap")
+    TSoftObjectPtr<UTexture2D> WorldMapTerrainClassTexture;
+
+    /** Money/risk/time per terrain class for route planning and costs (built-in land/water costs when unset) */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Expedition|WorldMap")
+    TSoftObjectPtr<UFCWorldMapTerrainCostTable> WorldMapTerrainCosts;
+
+    /** Event model for the route-risk estimate shown while planning (see FFCRouteRiskSimulator) */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Expedition|WorldMap")
+    FFCRouteRiskSettings RouteRiskSettings;
+
     /** Overworld minimum world bounds (for coordinate mapping) */
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Expedition|WorldMap")
     FVector2D OverworldWorldMin = FVector2D(-50000.f, -50000.f);
@@ -219,24 +238,42 @@ class FC_API UFCGameInstance : public UGameInstance
     UFUNCTION(BlueprintCallable, Category = "Resources")
     bool ConsumeMoney(int32 Amount);
 
-    /** Save current game state to specified slot */
+    /**
+     * Save current game state to specified slot. The state is captured immediately; the file
+     * is written in the background (see OnGameSaved). Returns false if nothing was queued.
+     */
     UFUNCTION(BlueprintCallable, Category = "SaveGame")
     bool SaveGame(const FString& SlotName);
 
-    /** Load game state from specified slot (async) */
+    /** Native variant: OnComplete runs on the game thread once the slot is on disk */
+    bool SaveGame(const FString& SlotName, FFCOnSaveWriteComplete OnComplete);
+
+    /** Delegate for when a background save write completes */
+    DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnGameSaved, const FString&, SlotName, bool, bSuccess);
+    UPROPERTY(BlueprintAssignable, Category = "SaveGame")
+    FOnGameSaved OnGameSaved;
+
+    /**
+     * Load game state from specified slot. The fade-out starts immediately while the save is
+     * read and deserialized on a background thread; the level opens once both are done.
+     */
     UFUNCTION(BlueprintCallable, Category = "SaveGame")
     void LoadGameAsync(const FString& SlotName);
 
-    /** Get list of available save slots with metadata */
+    /** Get list of available save slots, newest first (from the save index, no disk access) */
     UFUNCTION(BlueprintCallable, Category = "SaveGame")
     TArray<FString> GetAvailableSaveSlots();
 
+    /** Slot name, timestamp, level, version and thumbnail of every save, newest first */
+    UFUNCTION(BlueprintCallable, Category = "SaveGame")
+    TArray<FFCSaveSlotInfo> GetSaveSlotInfos();
+
     /** Get the most recent save slot name */
     UFUNCTION(BlueprintPure, Category = "SaveGame")
     FString GetMostRecentSave();
 
-    /** Delegate for when async load completes */
-    DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnGameLoaded, bool, bSuccess);
+    /** Delegate for when async load completes (timings of the background read/deserialize) */
+    DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnGameLoaded, bool, bSuccess, const FFCSaveLoadTimings&, Timings);
     UPROPERTY(BlueprintAssignable, Category = "SaveGame")
     FOnGameLoaded OnGameLoaded;
 
@@ -244,6 +281,10 @@ class FC_API UFCGameInstance : public UGameInstance
     UFUNCTION(BlueprintCallable, Category = "SaveGame")
     void RestorePlayerPosition();
 
+    /** GAME section codec (FFCGameStateData) */
+    static void WriteGameStateSection(FFCCampaignSnapshot& Snapshot, const FFCGameStateData& Data);
+    static bool ReadGameStateSection(const FFCCampaignSnapshot& Snapshot, FFCGameStateData& OutData);
+
     /** Check if we're currently restoring from a save game */
     UFUNCTION(BlueprintPure, Category = "SaveGame")
     bool IsRestoringSaveGame() const { return PendingLoadData != nullptr; }
@@ -256,9 +297,31 @@ private:
     UPROPERTY()
     TObjectPtr<UFCSaveGame> PendingLoadData;
 
+    /** Background load finished: apply it once the fade-out is done too */
+    void OnSaveLoadedForLoadGame(USaveGame* LoadedGame, const FFCSaveLoadTimings& Timings, uint32 RequestId, FString SlotName);
+
+    /** Fades out with the loading indicator; marks the fade done right away when no fade can run */
+    void BeginFadeOutForLoadGame();
+
+    UFUNCTION()
+    void OnFadeOutCompleteForLoadGame();
+
+    /** A fade-in was running when the load started: fade out once it ends */
+    UFUNCTION()
+    void OnFadeInCompleteForLoadGame();
+
+    /** Opens the level (or restores in place) when both the load and the fade-out are done */
+    void TryFinishLoadGame();
+
     /** Pending level name for deferred load after fade */
     FName PendingLevelLoad;
 
-    /** Timer handle for level load delay */
-    FTimerHandle LevelLoadTimerHandle;
+    /** Identifies the latest LoadGameAsync; results of superseded requests are dropped */
+    uint32 LoadGameRequestId = 0;
+
+    bool bLoadGameResultReady = false;
+    bool bLoadGameFadeOutDone = false;
+    FString LoadGameSlotName;
+    FFCSaveLoadTimings LoadGameTimings;
+    double LoadGameStartTime = 0.0;
 };
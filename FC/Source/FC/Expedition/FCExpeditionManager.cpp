@@ -2,13 +2,19 @@
 
 #include "Expedition/FCExpeditionManager.h"
 
+#include "Async/Async.h"
 #include "Core/UFCGameInstance.h"
+#include "Misc/CoreDelegates.h"
+#include "SaveGame/FCAutosaveManager.h"
+#include "SaveGame/FCCampaignSnapshot.h"
 #include "Engine/Engine.h"
 #include "Engine/Texture2D.h"
 #include "Engine/World.h"
-#include "Kismet/GameplayStatics.h"
 #include "TimerManager.h"
-#include "WorldMap/FCWorldMapSaveGame.h"
+#include "GameFramework/PlayerController.h"
+#include "World/FCOverworldCamera.h"
+#include "WorldMap/FCWorldMapStats.h"
+#include "WorldMap/FCWorldMapTerrainCostTable.h"
 
 DEFINE_LOG_CATEGORY(LogFCExpedition);
 DEFINE_LOG_CATEGORY(LogFCWorldMap);
@@ -25,6 +31,9 @@ void UFCExpeditionManager::Initialize(FSubsystemCollectionBase& Collection)
 	if (UFCGameInstance* GI = Cast<UFCGameInstance>(GetGameInstance()))
 	{
 		LandMaskTexture = GI->WorldMapLandMaskTexture;
+		TerrainClassTexture = GI->WorldMapTerrainClassTexture;
+		TerrainCostTable = GI->WorldMapTerrainCosts;
+		RouteRiskSettings = GI->RouteRiskSettings;
 		OverworldWorldMin = GI->OverworldWorldMin;
 		OverworldWorldMax = GI->OverworldWorldMax;
 		OfficeGridId = GI->OfficeGridId;
@@ -42,22 +51,34 @@ void UFCExpeditionManager::Initialize(FSubsystemCollectionBase& Collection)
 		UE_LOG(LogFCExpedition, Warning, TEXT("Failed to get UFCGameInstance - using default subsystem config"));
 	}
 
+	RouteCache.Empty(RouteCacheCapacity);
+
 	WorldMap_InitOrLoad();
 
 	FogTexture = CreateMaskTexture256();
+	FogDistanceTexture = CreateMaskTexture256(TF_Bilinear);
 	RouteTexture = CreateMaskTexture256();
 	RouteMask.Init(0, FFCWorldMapExploration::GlobalCount);
 
+	FogUploader.Init(FogTexture, FFCWorldMapExploration::GlobalSize, FFCWorldMapExploration::GlobalSize);
+	FogDistanceUploader.Init(FogDistanceTexture, FFCWorldMapExploration::GlobalSize, FFCWorldMapExploration::GlobalSize);
+	RouteUploader.Init(RouteTexture, FFCWorldMapExploration::GlobalSize, FFCWorldMapExploration::GlobalSize);
+
 	WorldMap_SyncFogTexture_Full();
-	UpdateMaskTextureFull(RouteTexture, RouteMask);
+	RouteUploader.MarkAllDirty();
+
+	// Initial contents go up immediately; later changes are batched until end of frame.
+	WorldMap_FlushTextureUploads();
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UFCExpeditionManager::WorldMap_FlushTextureUploads);
 }
 
 void UFCExpeditionManager::Deinitialize()
 {
-	if (bExplorationDirty)
-	{
-		WorldMap_SaveNow();
-	}
+	WorldMap_CancelPreviewRouteAsync();
+	WorldMap_CancelAlternativeRoutesAsync();
+
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	EndFrameHandle.Reset();
 
 	if (CurrentExpedition)
 	{
@@ -115,43 +136,185 @@ bool UFCExpeditionManager::IsExpeditionActive() const
 		CurrentExpedition->ExpeditionStatus == EFCExpeditionStatus::InProgress;
 }
 
+// -----------------------------------------------------------------------------
+// Campaign snapshot
+// -----------------------------------------------------------------------------
+
+namespace
+{
+	constexpr uint16 ExpeditionCampaignSectionVersion = 1;
+	constexpr uint16 WorldMapCampaignSectionVersion = 1;
+
+	/** Expedition section v1; symmetric, so the same code writes and reads */
+	void SerializeExpeditionCampaignSection(FArchive& Ar, UFCExpeditionData& Expedition)
+	{
+		uint8 Status = static_cast<uint8>(Expedition.ExpeditionStatus);
+
+		Ar << Expedition.ExpeditionName;
+		Ar << Expedition.StartDate;
+		Ar << Expedition.TargetRegion;
+		Ar << Expedition.StartingSupplies;
+		Ar << Status;
+		Ar << Expedition.SelectedGridId;
+		Ar << Expedition.SelectedStartGridId;
+		Ar << Expedition.SelectedStartSubId;
+		Ar << Expedition.PreviewTargetGridId;
+		Ar << Expedition.PreviewTargetSubId;
+		Ar << Expedition.PlannedRouteGlobalIds;
+		Ar << Expedition.PlannedMoneyCost;
+		Ar << Expedition.PlannedRiskCost;
+
+		Expedition.ExpeditionStatus = static_cast<EFCExpeditionStatus>(Status);
+	}
+}
+
+void UFCExpeditionManager::WriteCampaignSections(FFCCampaignSnapshot& Snapshot)
+{
+	WriteExpeditionSection(Snapshot, CurrentExpedition);
+
+	SCOPE_CYCLE_COUNTER(STAT_FCWorldMap_Save);
+	WriteWorldMapSection(Snapshot, WorldMap.GetRevealMask(), WorldMap.GetLandMask(), LandMaskAssetHash);
+}
+
+void UFCExpeditionManager::WriteExpeditionSection(FFCCampaignSnapshot& Snapshot, UFCExpeditionData* Expedition)
+{
+	Snapshot.AddSection(FCCampaignSection::Expedition, ExpeditionCampaignSectionVersion, [Expedition](FArchive& Ar)
+	{
+		bool bHasExpedition = Expedition != nullptr;
+		Ar << bHasExpedition;
+		if (bHasExpedition)
+		{
+			SerializeExpeditionCampaignSection(Ar, *Expedition);
+		}
+	});
+}
+
+bool UFCExpeditionManager::ReadExpeditionSection(const FFCCampaignSnapshot& Snapshot, UObject* Outer, UFCExpeditionData*& OutExpedition)
+{
+	OutExpedition = nullptr;
+	bool bKnownVersion = true;
+	const bool bRead = Snapshot.ReadSection(FCCampaignSection::Expedition, [Outer, &OutExpedition, &bKnownVersion](FArchive& Ar, uint16 Version)
+	{
+		bKnownVersion = Version <= ExpeditionCampaignSectionVersion;
+		bool bHasExpedition = false;
+		Ar << bHasExpedition;
+		if (bKnownVersion && bHasExpedition)
+		{
+			OutExpedition = NewObject<UFCExpeditionData>(Outer);
+			SerializeExpeditionCampaignSection(Ar, *OutExpedition);
+		}
+	});
+	return bRead && bKnownVersion;
+}
+
+void UFCExpeditionManager::WriteWorldMapSection(FFCCampaignSnapshot& Snapshot, const FFCWorldMapBitMask& Reveal, const FFCWorldMapBitMask& Land, uint32 AssetLandMaskHash)
+{
+	Snapshot.AddSection(FCCampaignSection::WorldMap, WorldMapCampaignSectionVersion, [&Reveal, &Land, AssetLandMaskHash](FArchive& Ar)
+	{
+		TArray<uint64> RevealWords = Reveal.GetWords();
+		uint32 LandHash = Land.GetHash();
+		bool bHasLand = LandHash != AssetLandMaskHash;
+
+		// The save container compresses the whole file, so the words go in raw.
+		Ar << RevealWords;
+		Ar << LandHash;
+		Ar << bHasLand;
+		if (bHasLand)
+		{
+			TArray<uint64> LandWords = Land.GetWords();
+			Ar << LandWords;
+		}
+	});
+}
+
+bool UFCExpeditionManager::ReadWorldMapSection(const FFCCampaignSnapshot& Snapshot, FFCWorldMapBitMask& OutReveal, FFCWorldMapBitMask& OutLand, bool& bOutHasLand)
+{
+	bool bValid = false;
+	bOutHasLand = false;
+	const bool bRead = Snapshot.ReadSection(FCCampaignSection::WorldMap, [&](FArchive& Ar, uint16 Version)
+	{
+		if (Version > WorldMapCampaignSectionVersion)
+		{
+			return;
+		}
+
+		TArray<uint64> Words;
+		uint32 LandHash = 0;
+		Ar << Words;
+		Ar << LandHash;
+		Ar << bOutHasLand;
+		bValid = OutReveal.FromWords(Words);
+		if (bOutHasLand)
+		{
+			Ar << Words;
+			bValid = bValid && OutLand.FromWords(Words) && OutLand.GetHash() == LandHash;
+		}
+	});
+	return bRead && bValid;
+}
+
+void UFCExpeditionManager::RestoreCampaignSections(const FFCCampaignSnapshot& Snapshot)
+{
+	RestoreExpeditionSection(Snapshot);
+	RestoreWorldMapSection(Snapshot);
+}
+
+void UFCExpeditionManager::RestoreExpeditionSection(const FFCCampaignSnapshot& Snapshot)
+{
+	UFCExpeditionData* Restored = nullptr;
+	if (!ReadExpeditionSection(Snapshot, this, Restored))
+	{
+		UE_LOG(LogFCExpedition, Warning, TEXT("RestoreExpeditionSection: Section missing or unreadable; keeping the current expedition"));
+		return;
+	}
+
+	CurrentExpedition = Restored;
+	UE_LOG(LogFCExpedition, Log, TEXT("Restored expedition from campaign snapshot: %s (route %d cells)"),
+		Restored ? *Restored->ExpeditionName : TEXT("none"), Restored ? Restored->PlannedRouteGlobalIds.Num() : 0);
+	OnExpeditionStateChanged.Broadcast(CurrentExpedition);
+}
+
+void UFCExpeditionManager::RestoreWorldMapSection(const FFCCampaignSnapshot& Snapshot)
+{
+	FFCWorldMapBitMask Reveal(FFCWorldMapExploration::GlobalSize, FFCWorldMapExploration::GlobalSize);
+	FFCWorldMapBitMask Land(FFCWorldMapExploration::GlobalSize, FFCWorldMapExploration::GlobalSize);
+	bool bHasLand = false;
+	if (!ReadWorldMapSection(Snapshot, Reveal, Land, bHasLand))
+	{
+		UE_LOG(LogFCWorldMap, Warning, TEXT("RestoreWorldMapSection: Section missing or unreadable; keeping the current exploration state"));
+		return;
+	}
+
+	WorldMap.SetRevealMask(Reveal);
+	if (bHasLand)
+	{
+		WorldMap.SetLandMask(Land);
+	}
+	else if (WorldMap.GetLandMask().GetHash() != LandMaskAssetHash)
+	{
+		WorldMap_LoadLandMaskIfAvailable();
+	}
+
+	WorldMap_ClearRoutePreview();
+	WorldMap_SyncFogTexture_Full();
+
+	UE_LOG(LogFCWorldMap, Log, TEXT("Restored world map from campaign snapshot (%d cells revealed%s)"),
+		WorldMap.GetRevealMask().CountAll(), bHasLand ? TEXT(", saved land mask") : TEXT(""));
+	OnWorldMapChanged.Broadcast();
+}
+
 // -----------------------------------------------------------------------------
 // World map runtime helpers
 // -----------------------------------------------------------------------------
 
 void UFCExpeditionManager::WorldMap_InitOrLoad()
 {
-	UE_LOG(LogFCWorldMap, Log, TEXT("WorldMap_InitOrLoad: Begin (SaveSlot=%s, UserIndex=%d)"),
-		TEXT("FC_WorldMapExploration"), WorldMapSaveUserIndex);
-	// NOTE: Save/load temporarily disabled while debugging default reveal behavior.
-	//UFCWorldMapSaveGame* Save = nullptr;
-	//if (UGameplayStatics::DoesSaveGameExist(WorldMapSaveSlot, WorldMapSaveUserIndex))
-	//{
-	//	UE_LOG(LogFCWorldMap, Log, TEXT("WorldMap_InitOrLoad: Save game exists for slot %s"), WorldMapSaveSlot);
-	//	Save = Cast<UFCWorldMapSaveGame>(UGameplayStatics::LoadGameFromSlot(WorldMapSaveSlot, WorldMapSaveUserIndex));
-	//}
-	//if (Save && Save->RevealMask.Num() == FFCWorldMapExploration::GlobalCount)
-	//{
-	//	UE_LOG(LogFCWorldMap, Log, TEXT("WorldMap_InitOrLoad: Loaded existing exploration state (RevealMask=%d, LandMask=%d)"),
-	//		Save->RevealMask.Num(), Save->LandMask.Num());
-	//	WorldMap.GetRevealMaskMutable() = Save->RevealMask;
-	//	if (Save->LandMask.Num() == FFCWorldMapExploration::GlobalCount)
-	//	{
-	//		WorldMap.SetLandMask(Save->LandMask);
-	//	}
-	//	else
-	//	{
-	//		WorldMap_LoadLandMaskIfAvailable();
-	//	}
-	//	UE_LOG(LogFCWorldMap, Log, TEXT("Loaded world map exploration from save game."));
-	//	return;
-	//}
+	UE_LOG(LogFCWorldMap, Log, TEXT("WorldMap_InitOrLoad: Begin"));
 
+	// Saved exploration arrives with the campaign snapshot (RestoreCampaignSections), not here.
 	WorldMap.ApplyDefaultRevealedAreas_NewGame(DefaultRevealedWorldMapGridIds);
 	WorldMap_LoadLandMaskIfAvailable();
-
-	//bExplorationDirty = true;
-	//WorldMap_SaveNow();
+	WorldMap_LoadTerrainIfAvailable();
 
 	UE_LOG(LogFCWorldMap, Log, TEXT("WorldMap_InitOrLoad: Initialized new exploration state (RevealMask non-zero regions applied)."));
 }
@@ -159,38 +322,42 @@ void UFCExpeditionManager::WorldMap_InitOrLoad()
 void UFCExpeditionManager::WorldMap_LoadLandMaskIfAvailable()
 {
 	TArray<uint8> NewLandMask;
-	NewLandMask.Init(1, FFCWorldMapExploration::GlobalCount);
+	ReadLandMaskTexture(LandMaskTexture.LoadSynchronous(), NewLandMask);
+	WorldMap.SetLandMask(NewLandMask);
+	LandMaskAssetHash = WorldMap.GetLandMask().GetHash();
+}
+
+bool UFCExpeditionManager::ReadLandMaskTexture(UTexture2D* Texture, TArray<uint8>& OutLandMask)
+{
+	OutLandMask.Init(1, FFCWorldMapExploration::GlobalCount);
 
-	UTexture2D* LandMaskAsset = LandMaskTexture.LoadSynchronous();
-	if (!LandMaskAsset || !LandMaskAsset->GetPlatformData() || LandMaskAsset->GetPlatformData()->Mips.Num() == 0)
+	if (!Texture || !Texture->GetPlatformData() || Texture->GetPlatformData()->Mips.Num() == 0)
 	{
-		WorldMap.SetLandMask(NewLandMask);
-		return;
+		return false;
 	}
 
 	const int32 ExpectedW = FFCWorldMapExploration::GlobalSize;
 	const int32 ExpectedH = FFCWorldMapExploration::GlobalSize;
-	const FTexture2DMipMap& Mip = LandMaskAsset->GetPlatformData()->Mips[0];
+	const FTexture2DMipMap& Mip = Texture->GetPlatformData()->Mips[0];
 
 	if (Mip.SizeX != ExpectedW || Mip.SizeY != ExpectedH)
 	{
 		UE_LOG(LogFCWorldMap, Warning, TEXT("Land mask texture size mismatch (%dx%d, expected 256x256)."),
 			Mip.SizeX, Mip.SizeY);
-		WorldMap.SetLandMask(NewLandMask);
-		return;
+		return false;
 	}
 
 	const void* DataPtr = Mip.BulkData.LockReadOnly();
 	if (!DataPtr)
 	{
 		Mip.BulkData.Unlock();
-		WorldMap.SetLandMask(NewLandMask);
-		return;
+		return false;
 	}
 
 	const int32 ByteCount = Mip.BulkData.GetBulkDataSize();
 	const uint8* Bytes = static_cast<const uint8*>(DataPtr);
 
+	bool bDecoded = true;
 	if (ByteCount == (ExpectedW * ExpectedH))
 	{
 		for (int32 Index = 0; Index < FFCWorldMapExploration::GlobalCount; ++Index)
@@ -198,7 +365,7 @@ void UFCExpeditionManager::WorldMap_LoadLandMaskIfAvailable()
 			// In the land mask texture, black (low value) represents land,
 			// white (high value) represents water. Interpret values <= 128
 			// as land, and > 128 as water.
-			NewLandMask[Index] = Bytes[Index] <= 128 ? 1 : 0;
+			OutLandMask[Index] = Bytes[Index] <= 128 ? 1 : 0;
 		}
 	}
 	else if (ByteCount == (ExpectedW * ExpectedH * 4))
@@ -208,62 +375,99 @@ void UFCExpeditionManager::WorldMap_LoadLandMaskIfAvailable()
 			const uint8 R = Bytes[Index * 4];
 			// Same convention for RGBA textures: dark pixels are land,
 			// bright pixels are water.
-			NewLandMask[Index] = R <= 128 ? 1 : 0;
+			OutLandMask[Index] = R <= 128 ? 1 : 0;
 		}
 	}
 	else
 	{
 		UE_LOG(LogFCWorldMap, Warning, TEXT("Land mask texture bulk data unexpected size: %d bytes"), ByteCount);
+		bDecoded = false;
 	}
 
 	Mip.BulkData.Unlock();
-	WorldMap.SetLandMask(NewLandMask);
+	return bDecoded;
 }
 
-void UFCExpeditionManager::WorldMap_SyncFogTexture_Full()
+void UFCExpeditionManager::WorldMap_LoadTerrainIfAvailable()
 {
-	UE_LOG(LogFCWorldMap, Verbose, TEXT("WorldMap_SyncFogTexture_Full: Syncing fog texture from RevealMask (Num=%d)"),
-		WorldMap.GetRevealMask().Num());
+	const UFCWorldMapTerrainCostTable* CostTable = TerrainCostTable.LoadSynchronous();
+	WorldMap.SetTerrainCosts(CostTable ? CostTable->Classes : TArray<FFCWorldMapTerrainCost>());
 
-	if (FogTexture)
+	UTexture2D* ClassAsset = TerrainClassTexture.LoadSynchronous();
+	if (!ClassAsset)
 	{
-		UpdateMaskTextureFull(FogTexture, WorldMap.GetRevealMask());
+		WorldMap.SetTerrainClasses(TArray<uint8>());
+		return;
 	}
-}
 
-void UFCExpeditionManager::WorldMap_UpdateFogPixel(int32 GlobalId)
-{
-	if (FogTexture)
+	const FTexturePlatformData* PlatformData = ClassAsset->GetPlatformData();
+	const FTexture2DMipMap* Mip = PlatformData && PlatformData->Mips.Num() > 0 ? &PlatformData->Mips[0] : nullptr;
+	if (!Mip || Mip->SizeX != FFCWorldMapExploration::GlobalSize || Mip->SizeY != FFCWorldMapExploration::GlobalSize)
+	{
+		UE_LOG(LogFCWorldMap, Warning, TEXT("Terrain class texture missing data or not 256x256; using land/water classes."));
+		WorldMap.SetTerrainClasses(TArray<uint8>());
+		return;
+	}
+
+	TArray<uint8> Classes;
+	const uint8* Bytes = static_cast<const uint8*>(Mip->BulkData.LockReadOnly());
+	const int32 ByteCount = Mip->BulkData.GetBulkDataSize();
+	if (Bytes && ByteCount == FFCWorldMapExploration::GlobalCount)
+	{
+		Classes.Append(Bytes, ByteCount);
+	}
+	else if (Bytes && ByteCount == FFCWorldMapExploration::GlobalCount * 4)
+	{
+		// 8-bit colour: the class is the first channel, same convention as the land mask.
+		Classes.SetNumUninitialized(FFCWorldMapExploration::GlobalCount);
+		for (int32 Index = 0; Index < FFCWorldMapExploration::GlobalCount; ++Index)
+		{
+			Classes[Index] = Bytes[Index * 4];
+		}
+	}
+	else
 	{
-		UpdateMaskTexturePixel(FogTexture, WorldMap.GetRevealMask(), GlobalId);
+		UE_LOG(LogFCWorldMap, Warning, TEXT("Terrain class texture bulk data unexpected size: %d bytes (needs uncompressed G8 or BGRA8)"), ByteCount);
 	}
+	Mip->BulkData.Unlock();
+
+	WorldMap.SetTerrainClasses(Classes);
+	UE_LOG(LogFCWorldMap, Log, TEXT("Terrain: %s classes, %s"), Classes.Num() > 0 ? TEXT("texture") : TEXT("land/water"),
+		CostTable ? *CostTable->GetName() : TEXT("built-in costs"));
 }
 
-void UFCExpeditionManager::WorldMap_StartAutosaveDebounced()
+void UFCExpeditionManager::WorldMap_SyncFogTexture_Full()
 {
-	bExplorationDirty = true;
+	UE_LOG(LogFCWorldMap, Verbose, TEXT("WorldMap_SyncFogTexture_Full: Syncing fog texture from RevealMask (Revealed=%d)"),
+		WorldMap.GetRevealMask().CountAll());
 
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(AutosaveTimer);
-		World->GetTimerManager().SetTimer(AutosaveTimer, this, &UFCExpeditionManager::WorldMap_SaveNow, 0.75f, false);
-	}
+	FogUploader.MarkAllDirty();
+
+	FogDistanceField.Rebuild(WorldMap.GetRevealMask());
+	FogDistanceUploader.MarkAllDirty();
 }
 
-void UFCExpeditionManager::WorldMap_SaveNow()
+void UFCExpeditionManager::WorldMap_FlushTextureUploads()
 {
-	UFCWorldMapSaveGame* Save = Cast<UFCWorldMapSaveGame>(UGameplayStatics::CreateSaveGameObject(UFCWorldMapSaveGame::StaticClass()));
-	if (!Save)
+	// The reveal mask is bit-packed; expand to one byte per texel only for the dirty rects.
+	FogUploader.Flush([this](const FIntRect& Rect, uint8* OutBytes, int32 Pitch)
 	{
-		return;
-	}
+		WorldMap.GetRevealMask().ExpandRectToBytes(Rect, OutBytes, Pitch, 255, 0);
+	});
 
-	Save->RevealMask = WorldMap.GetRevealMask();
-	Save->LandMask = WorldMap.GetLandMask();
+	FogDistanceUploader.Flush([this](const FIntRect& Rect, uint8* OutBytes, int32 Pitch)
+	{
+		FogDistanceField.CopyRect(Rect, OutBytes, Pitch);
+	});
 
-	UGameplayStatics::SaveGameToSlot(Save, WorldMapSaveSlot, WorldMapSaveUserIndex);
-	bExplorationDirty = false;
-	UE_LOG(LogFCWorldMap, VeryVerbose, TEXT("World map exploration saved."));
+	RouteUploader.Flush([this](const FIntRect& Rect, uint8* OutBytes, int32 Pitch)
+	{
+		for (int32 Y = Rect.Min.Y; Y < Rect.Max.Y; ++Y)
+		{
+			const uint8* Src = RouteMask.GetData() + FFCWorldMapExploration::XYToGlobalId(Rect.Min.X, Y);
+			FMemory::Memcpy(OutBytes + (Y - Rect.Min.Y) * Pitch, Src, Rect.Width());
+		}
+	});
 }
 
 // -----------------------------------------------------------------------------
@@ -306,7 +510,7 @@ bool UFCExpeditionManager::WorldMap_SelectGridArea(int32 GridId)
 
 bool UFCExpeditionManager::WorldMap_BuildPreviewRoute()
 {
-	UE_LOG(LogFCWorldMap, Log, TEXT("WorldMap_BuildPreviewRoute: Begin (CurrentExpedition=%p)"), CurrentExpedition.Get());
+	UE_LOG(LogFCWorldMap, Verbose, TEXT("WorldMap_BuildPreviewRoute: Begin (CurrentExpedition=%p)"), CurrentExpedition.Get());
 
 	if (!CurrentExpedition)
 	{
@@ -314,32 +518,331 @@ bool UFCExpeditionManager::WorldMap_BuildPreviewRoute()
 		return false;
 	}
 
+	// A synchronous build supersedes any async request still in flight.
+	WorldMap_CancelPreviewRouteAsync();
+
 	const int32 StartGlobal = FFCWorldMapExploration::AreaSubToGlobalId(OfficeGridId, OfficeSubId);
 	const int32 GoalGlobal = FFCWorldMapExploration::AreaSubToGlobalId(PreviewTargetGridId, PreviewTargetSubId);
 
 	TArray<int32> Path;
-	if (!WorldMap.FindShortestPath_BFS(StartGlobal, GoalGlobal, Path))
+	if (!WorldMap.IsReachable_Global(StartGlobal, GoalGlobal))
+	{
+		UE_LOG(LogFCWorldMap, Verbose, TEXT("WorldMap_BuildPreviewRoute: Target %d unreachable from office %d - rejected"), GoalGlobal, StartGlobal);
+		WorldMap_ApplyPreviewRoute(false, Path, 0, 0);
+		return false;
+	}
+
+	FFCCachedRoute Cached;
+	if (WorldMap_FindCachedRoute(StartGlobal, GoalGlobal, Cached))
+	{
+		WorldMap_ApplyPreviewRoute(true, Cached.Path, Cached.MoneyCost, Cached.RiskCost);
+		return true;
+	}
+
+	FFCWorldMapPathStats PathStats;
+	// Hierarchical planner: only the areas the route crosses are searched at cell level
+	if (!WorldMap.FindPath_Hierarchical(StartGlobal, GoalGlobal, Path, &PathStats))
 	{
 		UE_LOG(LogFCWorldMap, Warning, TEXT("Failed to build preview route from office to preview target."));
-		CurrentExpedition->PlannedRouteGlobalIds.Reset();
-		CurrentExpedition->PlannedMoneyCost = 0;
-		CurrentExpedition->PlannedRiskCost = 0;
+		WorldMap_ApplyPreviewRoute(false, Path, 0, 0);
 		return false;
 	}
 
-	CurrentExpedition->PlannedRouteGlobalIds = Path;
 	int32 Money = 0;
 	int32 Risk = 0;
 	ComputeCostsForPath(Path, Money, Risk);
-	CurrentExpedition->PlannedMoneyCost = Money;
-	CurrentExpedition->PlannedRiskCost = Risk;
+	WorldMap_CacheRoute(StartGlobal, GoalGlobal, WorldMap.GetGeneration(), Path, Money, Risk);
+	WorldMap_ApplyPreviewRoute(true, Path, Money, Risk);
+
+	UE_LOG(LogFCWorldMap, Verbose, TEXT("WorldMap_BuildPreviewRoute: Success (PathLen=%d, Money=%d, Risk=%d, Expanded=%d)"),
+		Path.Num(), Money, Risk, PathStats.NodesExpanded);
+
+	return true;
+}
+
+bool UFCExpeditionManager::WorldMap_BuildPreviewRouteAsync()
+{
+	if (!CurrentExpedition)
+	{
+		UE_LOG(LogFCWorldMap, Warning, TEXT("WorldMap_BuildPreviewRouteAsync: No CurrentExpedition - aborting"));
+		return false;
+	}
+
+	// Only the latest request may deliver; anything still queued or running is dropped.
+	WorldMap_CancelPreviewRouteAsync();
+
+	const int32 StartGlobal = FFCWorldMapExploration::AreaSubToGlobalId(OfficeGridId, OfficeSubId);
+	const int32 GoalGlobal = FFCWorldMapExploration::AreaSubToGlobalId(PreviewTargetGridId, PreviewTargetSubId);
+
+	// Impossible targets are answered immediately, no worker round-trip.
+	if (!WorldMap.IsReachable_Global(StartGlobal, GoalGlobal))
+	{
+		WorldMap_ApplyPreviewRoute(false, TArray<int32>(), 0, 0);
+		return false;
+	}
+
+	FFCCachedRoute Cached;
+	if (WorldMap_FindCachedRoute(StartGlobal, GoalGlobal, Cached))
+	{
+		WorldMap_ApplyPreviewRoute(true, Cached.Path, Cached.MoneyCost, Cached.RiskCost);
+		return true;
+	}
+
+	TSharedPtr<const FFCWorldMapExploration, ESPMode::ThreadSafe> Snapshot = WorldMap_GetPlanningSnapshot();
+	TSharedRef<FThreadSafeBool, ESPMode::ThreadSafe> CancelFlag = MakeShared<FThreadSafeBool, ESPMode::ThreadSafe>(false);
+	PreviewRouteCancelFlag = CancelFlag;
+
+	const uint32 RequestId = ++PreviewRouteRequestId;
+	TWeakObjectPtr<UFCExpeditionManager> WeakThis(this);
+
+	const uint32 Generation = Snapshot->GetGeneration();
+
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, Snapshot, CancelFlag, RequestId, Generation, StartGlobal, GoalGlobal]()
+	{
+		if (*CancelFlag)
+		{
+			return;
+		}
+
+		TArray<int32> Path;
+		int32 Money = 0;
+		int32 Risk = 0;
+		const bool bSuccess = Snapshot->FindPath_Hierarchical(StartGlobal, GoalGlobal, Path);
+		if (bSuccess)
+		{
+			Snapshot->ComputePathCosts(Path, Money, Risk);
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, CancelFlag, RequestId, Generation, StartGlobal, GoalGlobal, bSuccess, Path = MoveTemp(Path), Money, Risk]()
+		{
+			UFCExpeditionManager* This = WeakThis.Get();
+			if (!This || *CancelFlag || RequestId != This->PreviewRouteRequestId)
+			{
+				return;
+			}
+
+			This->PreviewRouteCancelFlag.Reset();
+			if (bSuccess)
+			{
+				This->WorldMap_CacheRoute(StartGlobal, GoalGlobal, Generation, Path, Money, Risk);
+			}
+			This->WorldMap_ApplyPreviewRoute(bSuccess, Path, Money, Risk);
+		});
+	});
+
+	return true;
+}
+
+void UFCExpeditionManager::WorldMap_CancelPreviewRouteAsync()
+{
+	if (PreviewRouteCancelFlag.IsValid())
+	{
+		*PreviewRouteCancelFlag = true;
+		PreviewRouteCancelFlag.Reset();
+	}
+}
+
+bool UFCExpeditionManager::WorldMap_IsPreviewRoutePending() const
+{
+	return PreviewRouteCancelFlag.IsValid();
+}
+
+bool UFCExpeditionManager::WorldMap_BuildAlternativeRoutesAsync(int32 NumRoutes)
+{
+	if (!CurrentExpedition)
+	{
+		UE_LOG(LogFCWorldMap, Warning, TEXT("WorldMap_BuildAlternativeRoutesAsync: No CurrentExpedition - aborting"));
+		return false;
+	}
+
+	WorldMap_CancelAlternativeRoutesAsync();
+
+	const int32 StartGlobal = FFCWorldMapExploration::AreaSubToGlobalId(OfficeGridId, OfficeSubId);
+	const int32 GoalGlobal = FFCWorldMapExploration::AreaSubToGlobalId(PreviewTargetGridId, PreviewTargetSubId);
+
+	if (!WorldMap.IsReachable_Global(StartGlobal, GoalGlobal))
+	{
+		AlternativeRoutes.Reset();
+		OnWorldMapAlternativeRoutesReady.Broadcast(false, AlternativeRoutes);
+		return false;
+	}
+
+	TSharedPtr<const FFCWorldMapExploration, ESPMode::ThreadSafe> Snapshot = WorldMap_GetPlanningSnapshot();
+	TSharedRef<FThreadSafeBool, ESPMode::ThreadSafe> CancelFlag = MakeShared<FThreadSafeBool, ESPMode::ThreadSafe>(false);
+	AlternativeRoutesCancelFlag = CancelFlag;
+
+	const uint32 RequestId = ++AlternativeRoutesRequestId;
+	TWeakObjectPtr<UFCExpeditionManager> WeakThis(this);
+	TSharedRef<FFCWorldMapAlternativeRoutes, ESPMode::ThreadSafe> Planner = AlternativeRoutePlanner;
+
+	FFCWorldMapAlternativeRoutes::FSettings Settings;
+	Settings.NumRoutes = FMath::Clamp(NumRoutes, 1, 16);
+
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, Snapshot, Planner, CancelFlag, RequestId, Settings, StartGlobal, GoalGlobal]()
+	{
+		if (*CancelFlag)
+		{
+			return;
+		}
+
+		TArray<FFCWorldMapRouteOption> Routes;
+		Planner->Find(*Snapshot, StartGlobal, GoalGlobal, Settings, Routes, &CancelFlag.Get());
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, CancelFlag, RequestId, Routes = MoveTemp(Routes)]() mutable
+		{
+			UFCExpeditionManager* This = WeakThis.Get();
+			if (!This || *CancelFlag || RequestId != This->AlternativeRoutesRequestId)
+			{
+				return;
+			}
+
+			This->AlternativeRoutesCancelFlag.Reset();
+			This->AlternativeRoutes = MoveTemp(Routes);
+			This->OnWorldMapAlternativeRoutesReady.Broadcast(This->AlternativeRoutes.Num() > 0, This->AlternativeRoutes);
+		});
+	});
+
+	return true;
+}
+
+void UFCExpeditionManager::WorldMap_CancelAlternativeRoutesAsync()
+{
+	if (AlternativeRoutesCancelFlag.IsValid())
+	{
+		*AlternativeRoutesCancelFlag = true;
+		AlternativeRoutesCancelFlag.Reset();
+	}
+}
+
+bool UFCExpeditionManager::WorldMap_ChooseAlternativeRoute(int32 RouteIndex)
+{
+	if (!CurrentExpedition || !AlternativeRoutes.IsValidIndex(RouteIndex))
+	{
+		return false;
+	}
 
-	UE_LOG(LogFCWorldMap, Log, TEXT("WorldMap_BuildPreviewRoute: Success (PathLen=%d, Money=%d, Risk=%d)"),
-		Path.Num(), Money, Risk);
+	// A chosen alternative replaces whatever preview is still being planned.
+	WorldMap_CancelPreviewRouteAsync();
 
+	const FFCWorldMapRouteOption& Route = AlternativeRoutes[RouteIndex];
+	WorldMap_ApplyPreviewRoute(true, Route.RouteGlobalIds, Route.MoneyCost, Route.RiskCost);
 	return true;
 }
 
+FFCRouteRiskEstimate UFCExpeditionManager::WorldMap_SimulateRouteRisk(const TArray<int32>& RouteGlobalIds, int32 Seed)
+{
+	const UFCGameInstance* GI = Cast<UFCGameInstance>(GetGameInstance());
+	if (!GI)
+	{
+		return FFCRouteRiskEstimate();
+	}
+
+	const FFCGameStateData& GameState = GI->GetGameStateData();
+	return FFCRouteRiskSimulator::Simulate(WorldMap, RouteGlobalIds, GameState.Supplies, GameState.Money, RouteRiskSettings, Seed);
+}
+
+FFCRouteRiskEstimate UFCExpeditionManager::WorldMap_SimulatePlannedRouteRisk(int32 Seed)
+{
+	if (!CurrentExpedition)
+	{
+		return FFCRouteRiskEstimate();
+	}
+	return WorldMap_SimulateRouteRisk(CurrentExpedition->PlannedRouteGlobalIds, Seed);
+}
+
+void UFCExpeditionManager::WorldMap_ApplyPreviewRoute(bool bSuccess, const TArray<int32>& Path, int32 Money, int32 Risk)
+{
+	if (CurrentExpedition)
+	{
+		if (bSuccess)
+		{
+			CurrentExpedition->PlannedRouteGlobalIds = Path;
+			CurrentExpedition->PlannedMoneyCost = Money;
+			CurrentExpedition->PlannedRiskCost = Risk;
+		}
+		else
+		{
+			CurrentExpedition->PlannedRouteGlobalIds.Reset();
+			CurrentExpedition->PlannedMoneyCost = 0;
+			CurrentExpedition->PlannedRiskCost = 0;
+		}
+	}
+
+	OnWorldMapPreviewRouteReady.Broadcast(bSuccess, bSuccess ? Path : TArray<int32>(), Money, Risk);
+}
+
+TSharedPtr<const FFCWorldMapExploration, ESPMode::ThreadSafe> UFCExpeditionManager::WorldMap_GetPlanningSnapshot()
+{
+	// Workers read an immutable copy; it is only re-taken after the live map changes.
+	if (!PlanningSnapshot.IsValid() || PlanningSnapshot->GetGeneration() != WorldMap.GetGeneration())
+	{
+		WorldMap.RefreshHierarchy();
+		PlanningSnapshot = MakeShared<const FFCWorldMapExploration, ESPMode::ThreadSafe>(WorldMap);
+	}
+	return PlanningSnapshot;
+}
+
+bool UFCExpeditionManager::WorldMap_FindCachedRoute(int32 StartGlobalId, int32 GoalGlobalId, FFCCachedRoute& OutRoute)
+{
+	const FFCRouteCacheKey Key{ StartGlobalId, GoalGlobalId, WorldMap.GetGeneration() };
+	if (const FFCCachedRoute* Found = RouteCache.FindAndTouch(Key))
+	{
+		OutRoute = *Found;
+		++RouteCacheHits;
+		INC_DWORD_STAT(STAT_FCWorldMap_RouteCacheHits);
+		return true;
+	}
+
+	++RouteCacheMisses;
+	INC_DWORD_STAT(STAT_FCWorldMap_RouteCacheMisses);
+	return false;
+}
+
+void UFCExpeditionManager::WorldMap_CacheRoute(int32 StartGlobalId, int32 GoalGlobalId, uint32 Generation, const TArray<int32>& Path, int32 Money, int32 Risk)
+{
+	FFCCachedRoute Entry;
+	Entry.Path = Path;
+	Entry.MoneyCost = Money;
+	Entry.RiskCost = Risk;
+	RouteCache.Add(FFCRouteCacheKey{ StartGlobalId, GoalGlobalId, Generation }, MoveTemp(Entry));
+	SET_DWORD_STAT(STAT_FCWorldMap_RouteCacheEntries, RouteCache.Num());
+}
+
+void UFCExpeditionManager::WorldMap_GetRouteCacheStats(int32& OutHits, int32& OutMisses) const
+{
+	OutHits = RouteCacheHits;
+	OutMisses = RouteCacheMisses;
+}
+
+bool UFCExpeditionManager::WorldMap_IsTargetReachable(int32 GridId, int32 SubId) const
+{
+	if (!FFCWorldMapExploration::IsValidGridId(GridId) || !FFCWorldMapExploration::IsValidSubId(SubId))
+	{
+		return false;
+	}
+
+	const int32 StartGlobal = FFCWorldMapExploration::AreaSubToGlobalId(OfficeGridId, OfficeSubId);
+	const int32 GoalGlobal = FFCWorldMapExploration::AreaSubToGlobalId(GridId, SubId);
+	return WorldMap.IsReachable_Global(StartGlobal, GoalGlobal);
+}
+
+bool UFCExpeditionManager::WorldMap_IsGridAreaReachable(int32 GridId)
+{
+	if (!FFCWorldMapExploration::IsValidGridId(GridId))
+	{
+		return false;
+	}
+
+	if (ReachableAreasGeneration != WorldMap.GetGeneration())
+	{
+		const int32 StartGlobal = FFCWorldMapExploration::AreaSubToGlobalId(OfficeGridId, OfficeSubId);
+		WorldMap.BuildReachableAreas(StartGlobal, ReachableGridIds);
+		ReachableAreasGeneration = WorldMap.GetGeneration();
+	}
+
+	return ReachableGridIds[GridId];
+}
+
 void UFCExpeditionManager::WorldMap_BeginRoutePreviewPaint(float StepSeconds)
 {
 	if (!CurrentExpedition || CurrentExpedition->PlannedRouteGlobalIds.Num() == 0)
@@ -380,7 +883,7 @@ void UFCExpeditionManager::WorldMap_ClearRoutePreview()
 		RouteMask[4240] = 1;
 	}
 
-	UpdateMaskTextureFull(RouteTexture, RouteMask);
+	RouteUploader.MarkAllDirty();
 }
 
 void UFCExpeditionManager::RoutePaint_Tick()
@@ -407,7 +910,10 @@ void UFCExpeditionManager::RoutePaint_Tick()
 	if (FFCWorldMapExploration::IsValidGlobalId(GlobalId))
 	{
 		RouteMask[GlobalId] = 255;
-		UpdateMaskTexturePixel(RouteTexture, RouteMask, GlobalId);
+
+		int32 GX, GY;
+		FFCWorldMapExploration::GlobalIdToXY(GlobalId, GX, GY);
+		RouteUploader.MarkDirtyCell(GX, GY);
 	}
 
 	++RoutePaintIndex;
@@ -418,6 +924,11 @@ void UFCExpeditionManager::RoutePaint_Tick()
 // -----------------------------------------------------------------------------
 
 void UFCExpeditionManager::WorldMap_RecordVisitedWorldLocation(const FVector& WorldLocation)
+{
+	WorldMap_RevealAroundWorldLocation(WorldLocation, WorldMap_GetActiveCrewVisionRange());
+}
+
+int32 UFCExpeditionManager::WorldMap_RevealAroundWorldLocation(const FVector& WorldLocation, float VisionRange)
 {
 	const float MinX = OverworldWorldMin.X;
 	const float MinY = OverworldWorldMin.Y;
@@ -432,15 +943,34 @@ void UFCExpeditionManager::WorldMap_RecordVisitedWorldLocation(const FVector& Wo
 
 	const int32 GX = FMath::FloorToInt(U * FFCWorldMapExploration::GlobalSize);
 	const int32 GY = FMath::FloorToInt(V * FFCWorldMapExploration::GlobalSize);
-	const int32 GlobalId = FFCWorldMapExploration::XYToGlobalId(GX, GY);
 
-	const bool bChanged = WorldMap.SetRevealed_Global(GlobalId, true);
-	if (bChanged)
+	// World units -> cells, using the smaller cell edge so the disc never under-reveals.
+	const float CellWorldSize = FMath::Min(DenX, DenY) / FFCWorldMapExploration::GlobalSize;
+	const int32 RadiusCells = FMath::FloorToInt(FMath::Max(0.f, VisionRange) / CellWorldSize);
+
+	FIntRect ChangedRect;
+	const int32 NumRevealed = WorldMap.RevealDisc_Global(GX, GY, RadiusCells, ChangedRect);
+	if (NumRevealed > 0)
 	{
-		WorldMap_UpdateFogPixel(GlobalId);
-		WorldMap_StartAutosaveDebounced();
+		// One dirty rect, one autosave request and one notification per brush stroke.
+		FogUploader.MarkDirtyRect(ChangedRect);
+		FogDistanceUploader.MarkDirtyRect(FogDistanceField.Update(WorldMap.GetRevealMask(), ChangedRect));
+		if (UFCAutosaveManager* AutosaveMgr = GetGameInstance()->GetSubsystem<UFCAutosaveManager>())
+		{
+			AutosaveMgr->RequestProgressAutosave();
+		}
 		OnWorldMapChanged.Broadcast();
 	}
+
+	return NumRevealed;
+}
+
+float UFCExpeditionManager::WorldMap_GetActiveCrewVisionRange() const
+{
+	const UGameInstance* GameInstance = GetGameInstance();
+	const APlayerController* PC = GameInstance ? GameInstance->GetFirstLocalPlayerController() : nullptr;
+	const AFCOverworldCamera* OverworldCamera = PC ? Cast<AFCOverworldCamera>(PC->GetViewTarget()) : nullptr;
+	return OverworldCamera ? OverworldCamera->GetCrewVisionRange() : 0.f;
 }
 
 // -----------------------------------------------------------------------------
@@ -449,33 +979,14 @@ void UFCExpeditionManager::WorldMap_RecordVisitedWorldLocation(const FVector& Wo
 
 void UFCExpeditionManager::ComputeCostsForPath(const TArray<int32>& Path, int32& OutMoney, int32& OutRisk) const
 {
-	OutMoney = 0;
-	OutRisk = 0;
-
-	for (int32 Index = 1; Index < Path.Num(); ++Index)
-	{
-		const int32 GlobalId = Path[Index];
-		const bool bIsWater = WorldMap.IsWater_Global(GlobalId);
-		const bool bWasRevealed = WorldMap.IsRevealed_Global(GlobalId);
-
-		OutMoney += bIsWater ? 3 : 1;
-
-		if (bIsWater)
-		{
-			OutRisk += bWasRevealed ? 2 : 3;
-		}
-		else
-		{
-			OutRisk += 1;
-		}
-	}
+	WorldMap.ComputePathCosts(Path, OutMoney, OutRisk);
 }
 
 // -----------------------------------------------------------------------------
 // Texture utilities
 // -----------------------------------------------------------------------------
 
-UTexture2D* UFCExpeditionManager::CreateMaskTexture256()
+UTexture2D* UFCExpeditionManager::CreateMaskTexture256(TextureFilter Filter)
 {
 	UTexture2D* Texture = UTexture2D::CreateTransient(FFCWorldMapExploration::GlobalSize, FFCWorldMapExploration::GlobalSize, PF_G8);
 	if (!Texture)
@@ -485,91 +996,9 @@ UTexture2D* UFCExpeditionManager::CreateMaskTexture256()
 
 	Texture->SRGB = false;
 	Texture->CompressionSettings = TC_Grayscale;
-	Texture->Filter = TF_Nearest;
+	Texture->Filter = Filter;
 	Texture->AddressX = TA_Clamp;
 	Texture->AddressY = TA_Clamp;
 	Texture->UpdateResource();
 	return Texture;
 }
-
-void UFCExpeditionManager::UpdateMaskTextureFull(UTexture2D* Texture, const TArray<uint8>& Data256)
-{
-	if (!Texture || Data256.Num() != FFCWorldMapExploration::GlobalCount)
-	{
-		return;
-	}
-
-	// CRITICAL: UpdateTextureRegions is async! Must allocate region + data on heap
-	// FUpdateTextureRegion2D(DestX, DestY, SrcX, SrcY, Width, Height)
-	FUpdateTextureRegion2D* Region = new FUpdateTextureRegion2D(
-		0, 0,                                    // Dest: top-left of texture
-		0, 0,                                    // Src: top-left of source buffer
-		FFCWorldMapExploration::GlobalSize,      // Width
-		FFCWorldMapExploration::GlobalSize       // Height
-	);
-
-	// Allocate full 256x256 buffer on heap and copy data
-	const int32 DataSize = FFCWorldMapExploration::GlobalCount;
-	uint8* Src = new uint8[DataSize];
-	FMemory::Memcpy(Src, Data256.GetData(), DataSize * sizeof(uint8));
-
-	// Pitch = number of bytes per row in source data
-	const uint32 SrcPitch = FFCWorldMapExploration::GlobalSize * sizeof(uint8);
-	const uint32 SrcBpp = sizeof(uint8);
-
-	Texture->UpdateTextureRegions(
-		0,                    // Mip index
-		1,                    // Num regions
-		Region,               // Region pointer (heap allocated)
-		SrcPitch,             // Src pitch (bytes per row)
-		SrcBpp,               // Src bytes per pixel
-		Src,                  // Source data pointer (heap allocated)
-		[](uint8* InSrcData, const FUpdateTextureRegion2D* InRegions)
-		{
-			// Cleanup callback executed by render thread after update completes
-			delete[] InSrcData;
-			delete InRegions;
-		}
-	);
-}
-
-void UFCExpeditionManager::UpdateMaskTexturePixel(UTexture2D* Texture, const TArray<uint8>& Data256, int32 GlobalId)
-{
-	if (!Texture || Data256.Num() != FFCWorldMapExploration::GlobalCount)
-	{
-		return;
-	}
-
-	if (!FFCWorldMapExploration::IsValidGlobalId(GlobalId))
-	{
-		return;
-	}
-
-	int32 GX, GY;
-	FFCWorldMapExploration::GlobalIdToXY(GlobalId, GX, GY);
-
-	// CRITICAL: UpdateTextureRegions is async! Must allocate region + data on heap
-	// so they remain valid when the render thread executes the update.
-	// FUpdateTextureRegion2D(DestX, DestY, SrcX, SrcY, Width, Height)
-	// SrcX/SrcY must be 0,0 because source buffer is only 1 byte
-	FUpdateTextureRegion2D* Region = new FUpdateTextureRegion2D(GX, GY, 0, 0, 1, 1);
-
-	// Allocate 1 byte on heap and copy pixel value
-	uint8* Src = new uint8[1];
-	Src[0] = Data256[GlobalId];
-
-	Texture->UpdateTextureRegions(
-		0,                    // Mip index
-		1,                    // Num regions
-		Region,               // Region pointer (heap allocated)
-		1,                    // Src pitch (1 byte per row for 1x1 region)
-		1,                    // Src bytes per pixel
-		Src,                  // Source data pointer (heap allocated)
-		[](uint8* InSrcData, const FUpdateTextureRegion2D* InRegions)
-		{
-			// Cleanup callback executed by render thread after update completes
-			delete[] InSrcData;
-			delete InRegions;
-		}
-	);
-}
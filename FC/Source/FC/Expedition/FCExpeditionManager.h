@@ -3,12 +3,20 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/LruCache.h"
+#include "HAL/ThreadSafeBool.h"
 #include "Logging/LogMacros.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "WorldMap/FCMaskTextureUploader.h"
+#include "WorldMap/FCWorldMapAlternativeRoutes.h"
+#include "WorldMap/FCWorldMapDistanceField.h"
 #include "WorldMap/FCWorldMapExploration.h"
 #include "Expedition/FCExpeditionData.h"
+#include "Expedition/FCRouteRiskSimulator.h"
 
 class UTexture2D;
+class UFCWorldMapTerrainCostTable;
+class FFCCampaignSnapshot;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogFCExpedition, Log, All);
 DECLARE_LOG_CATEGORY_EXTERN(LogFCWorldMap, Log, All);
@@ -17,6 +25,33 @@ DECLARE_LOG_CATEGORY_EXTERN(LogFCWorldMap, Log, All);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnExpeditionStateChanged, UFCExpeditionData*, ExpeditionData);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnWorldMapChanged);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnWorldMapPreviewRouteReady, bool, bSuccess, const TArray<int32>&, RouteGlobalIds, int32, MoneyCost, int32, RiskCost);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnWorldMapAlternativeRoutesReady, bool, bSuccess, const TArray<FFCWorldMapRouteOption>&, Routes);
+
+/** Route cache key: a route is only valid for the mask generation it was planned at. */
+struct FFCRouteCacheKey
+{
+	int32 StartGlobalId = INDEX_NONE;
+	int32 GoalGlobalId = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool operator==(const FFCRouteCacheKey& Other) const
+	{
+		return StartGlobalId == Other.StartGlobalId && GoalGlobalId == Other.GoalGlobalId && Generation == Other.Generation;
+	}
+
+	friend uint32 GetTypeHash(const FFCRouteCacheKey& Key)
+	{
+		return HashCombine(HashCombine(::GetTypeHash(Key.StartGlobalId), ::GetTypeHash(Key.GoalGlobalId)), ::GetTypeHash(Key.Generation));
+	}
+};
+
+struct FFCCachedRoute
+{
+	TArray<int32> Path;
+	int32 MoneyCost = 0;
+	int32 RiskCost = 0;
+};
 
 /**
  * UFCExpeditionManager
@@ -53,6 +88,25 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "FC|Expedition")
 	FOnExpeditionStateChanged OnExpeditionStateChanged;
 
+	// ---------------------------------------------------------------------
+	// Campaign snapshot
+	// ---------------------------------------------------------------------
+
+	/** Add the expedition and world map sections (called by UFCGameInstance::SaveGame) */
+	void WriteCampaignSections(FFCCampaignSnapshot& Snapshot);
+
+	/** Restore the expedition and world map sections of a loaded save (called when UFCGameInstance applies the load) */
+	void RestoreCampaignSections(const FFCCampaignSnapshot& Snapshot);
+
+	/** Section codecs, independent of the live state (the FC.Save.Benchmark automation test runs them on synthetic data) */
+	static void WriteExpeditionSection(FFCCampaignSnapshot& Snapshot, UFCExpeditionData* Expedition);
+	static bool ReadExpeditionSection(const FFCCampaignSnapshot& Snapshot, UObject* Outer, UFCExpeditionData*& OutExpedition);
+	static void WriteWorldMapSection(FFCCampaignSnapshot& Snapshot, const FFCWorldMapBitMask& Reveal, const FFCWorldMapBitMask& Land, uint32 AssetLandMaskHash);
+	static bool ReadWorldMapSection(const FFCCampaignSnapshot& Snapshot, FFCWorldMapBitMask& OutReveal, FFCWorldMapBitMask& OutLand, bool& bOutHasLand);
+
+	/** Decode a 256x256 land mask texture (dark = land) into GlobalCount bytes; false, leaving all land, if unusable */
+	static bool ReadLandMaskTexture(UTexture2D* Texture, TArray<uint8>& OutLandMask);
+
 	// ---------------------------------------------------------------------
 	// World map API (Blueprint-facing hooks for UI and gameplay)
 	// ---------------------------------------------------------------------
@@ -60,6 +114,14 @@ public:
 	UFUNCTION(BlueprintPure, Category = "FC|WorldMap")
 	UTexture2D* WorldMap_GetFogTexture() const { return FogTexture; }
 
+	/**
+	 * Signed distance to the fog edge (bilinear PF_G8): 0.5 at the edge, rising to 1 inside revealed
+	 * space and falling to 0 in the fog, saturating FFCWorldMapDistanceField::MaxDistanceCells away.
+	 * Lets materials draw soft edges and outlines with one fetch instead of blurring the fog mask.
+	 */
+	UFUNCTION(BlueprintPure, Category = "FC|WorldMap")
+	UTexture2D* WorldMap_GetFogDistanceTexture() const { return FogDistanceTexture; }
+
 	UFUNCTION(BlueprintPure, Category = "FC|WorldMap")
 	UTexture2D* WorldMap_GetRouteTexture() const { return RouteTexture; }
 
@@ -69,15 +131,91 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "FC|WorldMap|Planning")
 	bool WorldMap_BuildPreviewRoute();
 
+	/**
+	 * Plan the office -> preview target route on a background worker against a snapshot
+	 * of the masks. The result is written to CurrentExpedition and broadcast through
+	 * OnWorldMapPreviewRouteReady on the game thread. A new request cancels any in flight.
+	 * Returns false if the request was rejected immediately (no expedition / unreachable).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "FC|WorldMap|Planning")
+	bool WorldMap_BuildPreviewRouteAsync();
+
+	UFUNCTION(BlueprintCallable, Category = "FC|WorldMap|Planning")
+	void WorldMap_CancelPreviewRouteAsync();
+
+	UFUNCTION(BlueprintPure, Category = "FC|WorldMap|Planning")
+	bool WorldMap_IsPreviewRoutePending() const;
+
+	/** Route cache counters since startup (also visible via "stat FCWorldMap") */
+	UFUNCTION(BlueprintPure, Category = "FC|WorldMap|Planning")
+	void WorldMap_GetRouteCacheStats(int32& OutHits, int32& OutMisses) const;
+
+	/** Fired on the game thread whenever a preview route (sync or async) is applied */
+	UPROPERTY(BlueprintAssignable, Category = "FC|WorldMap|Planning")
+	FOnWorldMapPreviewRouteReady OnWorldMapPreviewRouteReady;
+
+	/**
+	 * Plan up to NumRoutes cheap, mutually different office -> preview target routes on a
+	 * background worker (penalty rerouting, see FFCWorldMapAlternativeRoutes), e.g. a safe
+	 * expensive route next to a risky cheap one. Results arrive through
+	 * OnWorldMapAlternativeRoutesReady; a new request cancels any in flight.
+	 * Returns false if the request was rejected immediately (no expedition / unreachable).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "FC|WorldMap|Planning")
+	bool WorldMap_BuildAlternativeRoutesAsync(int32 NumRoutes = 5);
+
+	UFUNCTION(BlueprintCallable, Category = "FC|WorldMap|Planning")
+	void WorldMap_CancelAlternativeRoutesAsync();
+
+	/** Routes of the last completed WorldMap_BuildAlternativeRoutesAsync, cheapest first */
+	UFUNCTION(BlueprintPure, Category = "FC|WorldMap|Planning")
+	const TArray<FFCWorldMapRouteOption>& WorldMap_GetAlternativeRoutes() const { return AlternativeRoutes; }
+
+	/** Make one of the alternative routes the expedition's planned route (applied like a preview route) */
+	UFUNCTION(BlueprintCallable, Category = "FC|WorldMap|Planning")
+	bool WorldMap_ChooseAlternativeRoute(int32 RouteIndex);
+
+	UPROPERTY(BlueprintAssignable, Category = "FC|WorldMap|Planning")
+	FOnWorldMapAlternativeRoutesReady OnWorldMapAlternativeRoutesReady;
+
+	/**
+	 * Monte Carlo estimate of what the route (start cell first) may cost on top of its plan:
+	 * supply loss and delay percentiles plus the chance of failing, against the campaign's
+	 * current supplies and money. Same Seed, same result; 10k trials fit in a frame.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "FC|WorldMap|Planning")
+	FFCRouteRiskEstimate WorldMap_SimulateRouteRisk(const TArray<int32>& RouteGlobalIds, int32 Seed = 0);
+
+	/** WorldMap_SimulateRouteRisk for the current expedition's planned route (empty estimate without one) */
+	UFUNCTION(BlueprintCallable, Category = "FC|WorldMap|Planning")
+	FFCRouteRiskEstimate WorldMap_SimulatePlannedRouteRisk(int32 Seed = 0);
+
+	/** O(1) feasibility check from the office to (GridId, SubId); safe to call on every hover. */
+	UFUNCTION(BlueprintCallable, Category = "FC|WorldMap|Planning")
+	bool WorldMap_IsTargetReachable(int32 GridId, int32 SubId) const;
+
+	/** True if any cell of the area is a reachable target (use to grey out unreachable areas). */
+	UFUNCTION(BlueprintCallable, Category = "FC|WorldMap|Planning")
+	bool WorldMap_IsGridAreaReachable(int32 GridId);
+
 	UFUNCTION(BlueprintCallable, Category = "FC|WorldMap|Planning")
 	void WorldMap_BeginRoutePreviewPaint(float StepSeconds = 0.03f);
 
 	UFUNCTION(BlueprintCallable, Category = "FC|WorldMap|Planning")
 	void WorldMap_ClearRoutePreview();
 
+	/** Reveal around the convoy using the active overworld camera's CrewVisionRange (single cell if none). */
 	UFUNCTION(BlueprintCallable, Category = "FC|WorldMap|Overworld")
 	void WorldMap_RecordVisitedWorldLocation(const FVector& WorldLocation);
 
+	/**
+	 * Reveal brush: every cell within VisionRange (world units) of WorldLocation in one pass.
+	 * Produces a single fog dirty rect, autosave trigger and OnWorldMapChanged broadcast.
+	 * Returns the number of newly revealed cells.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "FC|WorldMap|Overworld")
+	int32 WorldMap_RevealAroundWorldLocation(const FVector& WorldLocation, float VisionRange);
+
 	UPROPERTY(BlueprintAssignable, Category = "FC|WorldMap")
 	FOnWorldMapChanged OnWorldMapChanged;
 
@@ -88,6 +226,13 @@ public:
 	/** Land mask texture (configured via GameInstance) */
 	TSoftObjectPtr<UTexture2D> LandMaskTexture;
 
+	/** Terrain-class layer and its cost table (configured via GameInstance; both optional) */
+	TSoftObjectPtr<UTexture2D> TerrainClassTexture;
+	TSoftObjectPtr<UFCWorldMapTerrainCostTable> TerrainCostTable;
+
+	/** Event model of WorldMap_SimulateRouteRisk (configured via GameInstance) */
+	FFCRouteRiskSettings RouteRiskSettings;
+
 	/** Overworld world bounds (configured via GameInstance) */
 	FVector2D OverworldWorldMin = FVector2D(-50000.f, -50000.f);
 	FVector2D OverworldWorldMax = FVector2D(50000.f, 50000.f);
@@ -108,37 +253,84 @@ private:
 	UPROPERTY()
 	TObjectPtr<UFCExpeditionData> CurrentExpedition;
 
+	void RestoreExpeditionSection(const FFCCampaignSnapshot& Snapshot);
+	void RestoreWorldMapSection(const FFCCampaignSnapshot& Snapshot);
+
 	// World map runtime state ------------------------------------------------
 	void WorldMap_InitOrLoad();
 	void WorldMap_LoadLandMaskIfAvailable();
+
+	/** Apply TerrainCostTable and the TerrainClassTexture layer (built-in land/water classes when missing) */
+	void WorldMap_LoadTerrainIfAvailable();
 	void WorldMap_SyncFogTexture_Full();
-	void WorldMap_UpdateFogPixel(int32 GlobalId);
-	void WorldMap_StartAutosaveDebounced();
-	void WorldMap_SaveNow();
 
 	void RoutePaint_Tick();
 
-	UTexture2D* CreateMaskTexture256();
-	void UpdateMaskTextureFull(UTexture2D* Texture, const TArray<uint8>& Data256);
-	void UpdateMaskTexturePixel(UTexture2D* Texture, const TArray<uint8>& Data256, int32 GlobalId);
+	/** CrewVisionRange of the local player's AFCOverworldCamera view target (0 when not in the overworld) */
+	float WorldMap_GetActiveCrewVisionRange() const;
+
+	void WorldMap_ApplyPreviewRoute(bool bSuccess, const TArray<int32>& Path, int32 Money, int32 Risk);
+
+	/** Immutable, hierarchy-refreshed copy of WorldMap shared with planning workers */
+	TSharedPtr<const FFCWorldMapExploration, ESPMode::ThreadSafe> WorldMap_GetPlanningSnapshot();
+
+	bool WorldMap_FindCachedRoute(int32 StartGlobalId, int32 GoalGlobalId, FFCCachedRoute& OutRoute);
+	void WorldMap_CacheRoute(int32 StartGlobalId, int32 GoalGlobalId, uint32 Generation, const TArray<int32>& Path, int32 Money, int32 Risk);
+
+	UTexture2D* CreateMaskTexture256(TextureFilter Filter = TF_Nearest);
+
+	/** End-of-frame: push the batched fog/route dirty rects to the GPU */
+	void WorldMap_FlushTextureUploads();
 	void ComputeCostsForPath(const TArray<int32>& Path, int32& OutMoney, int32& OutRisk) const;
 
 	UPROPERTY()
 	TObjectPtr<UTexture2D> FogTexture;
 
+	UPROPERTY()
+	TObjectPtr<UTexture2D> FogDistanceTexture;
+
 	UPROPERTY()
 	TObjectPtr<UTexture2D> RouteTexture;
 
 	TArray<uint8> RouteMask;
 
+	FFCMaskTextureUploader FogUploader;
+	FFCMaskTextureUploader FogDistanceUploader;
+	FFCMaskTextureUploader RouteUploader;
+	FDelegateHandle EndFrameHandle;
+
 	FFCWorldMapExploration WorldMap;
 
+	/** CPU copy of FogDistanceTexture; follows every reveal change */
+	FFCWorldMapDistanceField FogDistanceField;
+
 	FTimerHandle RoutePaintTimer;
-	FTimerHandle AutosaveTimer;
 
 	int32 RoutePaintIndex = 0;
-	bool bExplorationDirty = false;
 
-	static constexpr const TCHAR* WorldMapSaveSlot = TEXT("FC_WorldMapExploration");
-	static constexpr int32 WorldMapSaveUserIndex = 0;
+	/** Hash of the land mask built from LandMaskTexture; saves omit an identical land mask */
+	uint32 LandMaskAssetHash = 0;
+
+	/** Per-GridId reachability from the office, rebuilt lazily when the map generation moves */
+	TBitArray<> ReachableGridIds;
+	uint32 ReachableAreasGeneration = MAX_uint32;
+
+	TSharedPtr<const FFCWorldMapExploration, ESPMode::ThreadSafe> PlanningSnapshot;
+
+	/** Recently planned routes; entries from older generations simply age out */
+	TLruCache<FFCRouteCacheKey, FFCCachedRoute> RouteCache;
+	int32 RouteCacheHits = 0;
+	int32 RouteCacheMisses = 0;
+
+	static constexpr int32 RouteCacheCapacity = 64;
+
+	/** Search buffers shared by every alternative-route request (the planner locks them per run) */
+	TSharedRef<FFCWorldMapAlternativeRoutes, ESPMode::ThreadSafe> AlternativeRoutePlanner = MakeShared<FFCWorldMapAlternativeRoutes, ESPMode::ThreadSafe>();
+	TSharedPtr<FThreadSafeBool, ESPMode::ThreadSafe> AlternativeRoutesCancelFlag;
+	uint32 AlternativeRoutesRequestId = 0;
+	TArray<FFCWorldMapRouteOption> AlternativeRoutes;
+
+	/** Cancellation flag of the in-flight async preview route (null when idle) */
+	TSharedPtr<FThreadSafeBool, ESPMode::ThreadSafe> PreviewRouteCancelFlag;
+	uint32 PreviewRouteRequestId = 0;
 };
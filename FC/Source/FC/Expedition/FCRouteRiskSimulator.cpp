@@ -0,0 +1,158 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#include "Expedition/FCRouteRiskSimulator.h"
+
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "WorldMap/FCWorldMapExploration.h"
+#include "WorldMap/FCWorldMapStats.h"
+
+#include "Logging/LogMacros.h"
+#include "Expedition/FCExpeditionManager.h" // for LogFCExpedition declaration
+
+namespace FCRouteRiskSimulation
+{
+	/** Trials per ParallelFor task; large enough that scheduling stays negligible */
+	constexpr int32 TrialsPerBatch = 256;
+
+	/** Value at fraction P (0..1) of an ascending array (nearest rank) */
+	int32 Percentile(const TArray<int32>& Sorted, float P)
+	{
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(P * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+		return Sorted[Index];
+	}
+
+	float Mean(const TArray<int32>& Values)
+	{
+		int64 Sum = 0;
+		for (const int32 Value : Values)
+		{
+			Sum += Value;
+		}
+		return static_cast<float>(static_cast<double>(Sum) / Values.Num());
+	}
+}
+
+FFCRouteRiskEstimate FFCRouteRiskSimulator::Simulate(const FFCWorldMapExploration& Map, const TArray<int32>& Route,
+	int32 Supplies, int32 Money, const FFCRouteRiskSettings& Settings, int32 Seed)
+{
+	using namespace FCRouteRiskSimulation;
+
+	SCOPE_CYCLE_COUNTER(STAT_FCWorldMap_RouteRisk);
+	const double StartTime = FPlatformTime::Seconds();
+
+	FFCRouteRiskEstimate Estimate;
+	if (Route.Num() < 2)
+	{
+		return Estimate;
+	}
+
+	// Per-step event chance from the entered cell's risk; the start cell is never entered.
+	TArray<float> StepEventChance;
+	StepEventChance.Reserve(Route.Num() - 1);
+	for (int32 Index = 1; Index < Route.Num(); ++Index)
+	{
+		if (!FFCWorldMapExploration::IsValidGlobalId(Route[Index]))
+		{
+			UE_LOG(LogFCExpedition, Warning, TEXT("FFCRouteRiskSimulator: invalid cell %d in route"), Route[Index]);
+			return Estimate;
+		}
+
+		int32 CellMoney, CellRisk, CellTime;
+		Map.GetCellCosts_Global(Route[Index], CellMoney, CellRisk, CellTime);
+		Estimate.PlannedTime += CellTime;
+		StepEventChance.Add(FMath::Min(CellRisk * Settings.EventChancePerRisk, Settings.MaxEventChancePerStep));
+	}
+
+	const int32 NumTrials = FMath::Max(1, Settings.Trials);
+	const int32 NumSteps = StepEventChance.Num();
+	const int32 NumBatches = FMath::DivideAndRoundUp(NumTrials, TrialsPerBatch);
+
+	// Event kinds as thresholds on one roll in [0, 1): fatal, then supply loss, then delay.
+	const float FatalShare = FMath::Clamp(Settings.FatalEventShare, 0.f, 1.f);
+	const float SupplyShare = FatalShare + (1.f - FatalShare) * FMath::Clamp(Settings.SupplyEventShare, 0.f, 1.f);
+	const int32 LossMin = FMath::Max(0, Settings.SupplyLossMin);
+	const int32 LossMax = FMath::Max(LossMin, Settings.SupplyLossMax);
+	const int32 DelayMin = FMath::Max(0, Settings.DelayMin);
+	const int32 DelayMax = FMath::Max(DelayMin, Settings.DelayMax);
+
+	// The expedition eats through the planned time regardless; a shortfall is bought back while money lasts.
+	const int64 SpareSupplies = static_cast<int64>(Supplies) - static_cast<int64>(Estimate.PlannedTime) * Settings.SuppliesPerTimeUnit;
+	const int64 BuyableSupplies = Settings.SupplyPrice > 0 ? FMath::Max<int64>(0, Money) / Settings.SupplyPrice : MAX_int32;
+	const int64 Reserve = SpareSupplies + BuyableSupplies;
+
+	TArray<int32> SupplyLoss;
+	TArray<int32> Delay;
+	TArray<uint8> Failed;
+	SupplyLoss.SetNumUninitialized(NumTrials);
+	Delay.SetNumUninitialized(NumTrials);
+	Failed.SetNumUninitialized(NumTrials);
+
+	ParallelFor(NumBatches, [&](int32 Batch)
+	{
+		const int32 FirstTrial = Batch * TrialsPerBatch;
+		const int32 EndTrial = FMath::Min(FirstTrial + TrialsPerBatch, NumTrials);
+		for (int32 Trial = FirstTrial; Trial < EndTrial; ++Trial)
+		{
+			// Own stream per trial: the outcome depends on (Seed, Trial) only, not on the batch layout.
+			FRandomStream Stream(static_cast<int32>(HashCombineFast(static_cast<uint32>(Seed), static_cast<uint32>(Trial) * 0x9E3779B9u)));
+
+			int32 TrialLoss = 0;
+			int32 TrialDelay = 0;
+			bool bFatal = false;
+			for (int32 Step = 0; Step < NumSteps && !bFatal; ++Step)
+			{
+				if (Stream.GetFraction() >= StepEventChance[Step])
+				{
+					continue;
+				}
+
+				const float Kind = Stream.GetFraction();
+				if (Kind < FatalShare)
+				{
+					bFatal = true;
+				}
+				else if (Kind < SupplyShare)
+				{
+					TrialLoss += Stream.RandRange(LossMin, LossMax);
+				}
+				else
+				{
+					TrialDelay += Stream.RandRange(DelayMin, DelayMax);
+				}
+			}
+
+			TrialLoss += TrialDelay * Settings.SuppliesPerTimeUnit;
+			SupplyLoss[Trial] = TrialLoss;
+			Delay[Trial] = TrialDelay;
+			Failed[Trial] = (bFatal || TrialLoss > Reserve) ? 1 : 0;
+		}
+	});
+
+	int32 NumFailed = 0;
+	for (const uint8 bFailed : Failed)
+	{
+		NumFailed += bFailed;
+	}
+
+	Estimate.NumTrials = NumTrials;
+	Estimate.FailureChance = static_cast<float>(NumFailed) / NumTrials;
+	Estimate.SupplyLossMean = Mean(SupplyLoss);
+	Estimate.DelayMean = Mean(Delay);
+
+	SupplyLoss.Sort();
+	Delay.Sort();
+	Estimate.SupplyLossP50 = Percentile(SupplyLoss, 0.5f);
+	Estimate.SupplyLossP90 = Percentile(SupplyLoss, 0.9f);
+	Estimate.SupplyLossP99 = Percentile(SupplyLoss, 0.99f);
+	Estimate.DelayP50 = Percentile(Delay, 0.5f);
+	Estimate.DelayP90 = Percentile(Delay, 0.9f);
+	Estimate.DelayP99 = Percentile(Delay, 0.99f);
+
+	Estimate.SimulationMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	UE_LOG(LogFCExpedition, Verbose, TEXT("FFCRouteRiskSimulator: %d steps, %d trials, seed %d -> Failure=%.3f LossP90=%d DelayP90=%d (%.2f ms)"),
+		NumSteps, NumTrials, Seed, Estimate.FailureChance, Estimate.SupplyLossP90, Estimate.DelayP90, Estimate.SimulationMs);
+	return Estimate;
+}
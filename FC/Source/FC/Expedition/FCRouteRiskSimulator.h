@@ -0,0 +1,118 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FCRouteRiskSimulator.generated.h"
+
+class FFCWorldMapExploration;
+
+/** Event model of the route-risk simulation ("Routenrisiko & negative Events") */
+USTRUCT(BlueprintType)
+struct FC_API FFCRouteRiskSettings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Expedition|RouteRisk", meta = (ClampMin = "1", ClampMax = "1000000"))
+	int32 Trials = 10000;
+
+	/** Chance of a negative event on a step, per point of the entered cell's risk */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Expedition|RouteRisk", meta = (ClampMin = "0", ClampMax = "1"))
+	float EventChancePerRisk = 0.02f;
+
+	/** Upper bound of the per-step event chance, whatever the risk */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Expedition|RouteRisk", meta = (ClampMin = "0", ClampMax = "1"))
+	float MaxEventChancePerStep = 0.5f;
+
+	/** Share of events that end the expedition outright */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Expedition|RouteRisk", meta = (ClampMin = "0", ClampMax = "1"))
+	float FatalEventShare = 0.02f;
+
+	/** Share of the non-fatal events that destroy supplies; the rest delay the expedition */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Expedition|RouteRisk", meta = (ClampMin = "0", ClampMax = "1"))
+	float SupplyEventShare = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Expedition|RouteRisk", meta = (ClampMin = "0"))
+	int32 SupplyLossMin = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Expedition|RouteRisk", meta = (ClampMin = "0"))
+	int32 SupplyLossMax = 5;
+
+	/** Extra time units per delay event */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Expedition|RouteRisk", meta = (ClampMin = "0"))
+	int32 DelayMin = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Expedition|RouteRisk", meta = (ClampMin = "0"))
+	int32 DelayMax = 3;
+
+	/** Supplies eaten per time unit on the road */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Expedition|RouteRisk", meta = (ClampMin = "0"))
+	int32 SuppliesPerTimeUnit = 1;
+
+	/** Money per supply bought to cover a shortfall; the expedition fails when money runs out too */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Expedition|RouteRisk", meta = (ClampMin = "0"))
+	int32 SupplyPrice = 5;
+};
+
+/** Outcome distribution of a simulated route (what the planning widget shows) */
+USTRUCT(BlueprintType)
+struct FC_API FFCRouteRiskEstimate
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Expedition|RouteRisk")
+	int32 NumTrials = 0;
+
+	/** Route time without events (sum of the terrain time costs) */
+	UPROPERTY(BlueprintReadOnly, Category = "Expedition|RouteRisk")
+	int32 PlannedTime = 0;
+
+	/** Supplies lost to events and to the extra days of delays */
+	UPROPERTY(BlueprintReadOnly, Category = "Expedition|RouteRisk")
+	float SupplyLossMean = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Expedition|RouteRisk")
+	int32 SupplyLossP50 = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Expedition|RouteRisk")
+	int32 SupplyLossP90 = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Expedition|RouteRisk")
+	int32 SupplyLossP99 = 0;
+
+	/** Extra time units on top of PlannedTime */
+	UPROPERTY(BlueprintReadOnly, Category = "Expedition|RouteRisk")
+	float DelayMean = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Expedition|RouteRisk")
+	int32 DelayP50 = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Expedition|RouteRisk")
+	int32 DelayP90 = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Expedition|RouteRisk")
+	int32 DelayP99 = 0;
+
+	/** Fraction of trials ending in a fatal event or without supplies and money (0..1) */
+	UPROPERTY(BlueprintReadOnly, Category = "Expedition|RouteRisk")
+	float FailureChance = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Expedition|RouteRisk")
+	float SimulationMs = 0.f;
+};
+
+/**
+ * FFCRouteRiskSimulator rolls negative events along a planned route, many times over.
+ * - Every step enters a cell; its terrain risk sets the event chance, its time the planned duration.
+ * - Events are fatal, destroy supplies or delay the expedition (which eats more supplies).
+ * - Trials run in batches through ParallelFor. Each trial seeds its own stream from (Seed, trial
+ *   index), so results are identical for a seed whatever the thread count or scheduling.
+ * - Per-step chances are gathered once up front; a trial is a tight loop over a float array.
+ */
+class FC_API FFCRouteRiskSimulator
+{
+public:
+	/** Simulate Route (start cell first) against the supplies and money available to the expedition. */
+	static FFCRouteRiskEstimate Simulate(const FFCWorldMapExploration& Map, const TArray<int32>& Route,
+		int32 Supplies, int32 Money, const FFCRouteRiskSettings& Settings, int32 Seed);
+};
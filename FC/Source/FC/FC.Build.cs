@@ -23,7 +23,7 @@ public class FC : ModuleRules
 			"Slate"
 		});
 
-		PrivateDependencyModuleNames.AddRange(new string[] { });
+		PrivateDependencyModuleNames.AddRange(new string[] { "ImageCore" });
 
 		PublicIncludePaths.AddRange(new string[] {
 			"FC",
@@ -0,0 +1,304 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#include "Interaction/FCInteractableDispatch.h"
+
+#include "GameFramework/Actor.h"
+#include "Interaction/IFCInteractable.h"
+#include "UObject/ObjectKey.h"
+
+namespace FCInteractableDispatchCache
+{
+	/** One bit per interface function in FClassInfo::NativeMask */
+	enum EFunc : int32
+	{
+		OnInteract,
+		GetInteractionPrompt,
+		CanInteract,
+		GetInteractionRange,
+		GetInteractionPriority,
+		GetAvailableActions,
+		ExecuteAction,
+		GetPOIName,
+		CanExecuteAction,
+		NumFuncs
+	};
+
+	const FName FuncNames[NumFuncs] =
+	{
+		GET_FUNCTION_NAME_CHECKED(IIFCInteractable, OnInteract),
+		GET_FUNCTION_NAME_CHECKED(IIFCInteractable, GetInteractionPrompt),
+		GET_FUNCTION_NAME_CHECKED(IIFCInteractable, CanInteract),
+		GET_FUNCTION_NAME_CHECKED(IIFCInteractable, GetInteractionRange),
+		GET_FUNCTION_NAME_CHECKED(IIFCInteractable, GetInteractionPriority),
+		GET_FUNCTION_NAME_CHECKED(IIFCInteractablePOI, GetAvailableActions),
+		GET_FUNCTION_NAME_CHECKED(IIFCInteractablePOI, ExecuteAction),
+		GET_FUNCTION_NAME_CHECKED(IIFCInteractablePOI, GetPOIName),
+		GET_FUNCTION_NAME_CHECKED(IIFCInteractablePOI, CanExecuteAction),
+	};
+
+	struct FClassInfo
+	{
+		bool bInteractable = false;
+		bool bPOI = false;
+
+		/** Byte offset of the native interface subobject, INDEX_NONE if implemented in Blueprint only */
+		int32 InteractableOffset = INDEX_NONE;
+		int32 POIOffset = INDEX_NONE;
+
+		uint32 NativeMask = 0;
+
+		bool IsNative(EFunc Func) const { return (NativeMask >> Func) & 1u; }
+	};
+
+	/** Keys are weak, so a class reinstanced (Blueprint recompile) or unloaded simply misses. */
+	TMap<TObjectKey<UClass>, FClassInfo> ClassInfos;
+
+	/** Last class looked up; focus traces hit the same few classes over and over */
+	TObjectKey<UClass> LastClass;
+	const FClassInfo* LastInfo = nullptr;
+
+	int32 GetNativeOffset(const UObject* Object, const UClass* Interface)
+	{
+		const void* Address = const_cast<UObject*>(Object)->GetNativeInterfaceAddress(const_cast<UClass*>(Interface));
+		return Address ? static_cast<int32>(static_cast<const uint8*>(Address) - reinterpret_cast<const uint8*>(Object)) : INDEX_NONE;
+	}
+
+	/** A function stays native unless the class (or a Blueprint parent) overrides it in script */
+	void ResolveNativeFuncs(const UClass* Class, int32 FirstFunc, int32 LastFunc, FClassInfo& Info)
+	{
+		for (int32 Func = FirstFunc; Func <= LastFunc; ++Func)
+		{
+			const UFunction* Function = Class->FindFunctionByName(FuncNames[Func]);
+			if (!Function || Function->HasAnyFunctionFlags(FUNC_Native))
+			{
+				Info.NativeMask |= 1u << Func;
+			}
+		}
+	}
+
+	FClassInfo BuildClassInfo(const UObject* Object)
+	{
+		const UClass* Class = Object->GetClass();
+
+		FClassInfo Info;
+		Info.bInteractable = Class->ImplementsInterface(UIFCInteractable::StaticClass());
+		Info.bPOI = Class->ImplementsInterface(UIFCInteractablePOI::StaticClass());
+
+		if (Info.bInteractable)
+		{
+			Info.InteractableOffset = GetNativeOffset(Object, UIFCInteractable::StaticClass());
+			if (Info.InteractableOffset != INDEX_NONE)
+			{
+				ResolveNativeFuncs(Class, OnInteract, GetInteractionPriority, Info);
+			}
+		}
+
+		if (Info.bPOI)
+		{
+			Info.POIOffset = GetNativeOffset(Object, UIFCInteractablePOI::StaticClass());
+			if (Info.POIOffset != INDEX_NONE)
+			{
+				ResolveNativeFuncs(Class, GetAvailableActions, CanExecuteAction, Info);
+			}
+		}
+
+		return Info;
+	}
+
+	const FClassInfo& GetClassInfo(const UObject* Object)
+	{
+		checkSlow(IsInGameThread());
+
+		const TObjectKey<UClass> ClassKey(Object->GetClass());
+		if (LastInfo && LastClass == ClassKey)
+		{
+			return *LastInfo;
+		}
+
+		const FClassInfo* Info = ClassInfos.Find(ClassKey);
+		if (!Info)
+		{
+			Info = &ClassInfos.Add(ClassKey, BuildClassInfo(Object));
+		}
+
+		LastClass = ClassKey;
+		LastInfo = Info;
+		return *Info;
+	}
+
+	template <typename InterfaceType>
+	InterfaceType* GetInterface(const UObject* Object, int32 Offset)
+	{
+		return reinterpret_cast<InterfaceType*>(reinterpret_cast<uint8*>(const_cast<UObject*>(Object)) + Offset);
+	}
+}
+
+// -----------------------------------------------------------------------------
+// Capability checks
+// -----------------------------------------------------------------------------
+
+bool FFCInteractableDispatch::IsInteractable(const AActor* Actor)
+{
+	return Actor && FCInteractableDispatchCache::GetClassInfo(Actor).bInteractable;
+}
+
+bool FFCInteractableDispatch::IsPOI(const AActor* Actor)
+{
+	return Actor && FCInteractableDispatchCache::GetClassInfo(Actor).bPOI;
+}
+
+// -----------------------------------------------------------------------------
+// IIFCInteractable
+// -----------------------------------------------------------------------------
+
+void FFCInteractableDispatch::OnInteract(AActor* Actor, AActor* Interactor)
+{
+	using namespace FCInteractableDispatchCache;
+
+	const FClassInfo& Info = GetClassInfo(Actor);
+	if (Info.IsNative(EFunc::OnInteract))
+	{
+		GetInterface<IIFCInteractable>(Actor, Info.InteractableOffset)->OnInteract_Implementation(Interactor);
+		return;
+	}
+	IIFCInteractable::Execute_OnInteract(Actor, Interactor);
+}
+
+FText FFCInteractableDispatch::GetInteractionPrompt(const AActor* Actor)
+{
+	using namespace FCInteractableDispatchCache;
+
+	const FClassInfo& Info = GetClassInfo(Actor);
+	if (Info.IsNative(EFunc::GetInteractionPrompt))
+	{
+		return GetInterface<const IIFCInteractable>(Actor, Info.InteractableOffset)->GetInteractionPrompt_Implementation();
+	}
+	return IIFCInteractable::Execute_GetInteractionPrompt(Actor);
+}
+
+bool FFCInteractableDispatch::CanInteract(const AActor* Actor, AActor* Interactor)
+{
+	using namespace FCInteractableDispatchCache;
+
+	const FClassInfo& Info = GetClassInfo(Actor);
+	if (Info.IsNative(EFunc::CanInteract))
+	{
+		return GetInterface<const IIFCInteractable>(Actor, Info.InteractableOffset)->CanInteract_Implementation(Interactor);
+	}
+	return IIFCInteractable::Execute_CanInteract(Actor, Interactor);
+}
+
+float FFCInteractableDispatch::GetInteractionRange(const AActor* Actor)
+{
+	using namespace FCInteractableDispatchCache;
+
+	const FClassInfo& Info = GetClassInfo(Actor);
+	if (Info.IsNative(EFunc::GetInteractionRange))
+	{
+		return GetInterface<const IIFCInteractable>(Actor, Info.InteractableOffset)->GetInteractionRange_Implementation();
+	}
+	return IIFCInteractable::Execute_GetInteractionRange(Actor);
+}
+
+int32 FFCInteractableDispatch::GetInteractionPriority(const AActor* Actor)
+{
+	using namespace FCInteractableDispatchCache;
+
+	const FClassInfo& Info = GetClassInfo(Actor);
+	if (Info.IsNative(EFunc::GetInteractionPriority))
+	{
+		return GetInterface<const IIFCInteractable>(Actor, Info.InteractableOffset)->GetInteractionPriority_Implementation();
+	}
+	return IIFCInteractable::Execute_GetInteractionPriority(Actor);
+}
+
+// -----------------------------------------------------------------------------
+// IIFCInteractablePOI
+// -----------------------------------------------------------------------------
+
+TArray<FFCPOIActionData> FFCInteractableDispatch::GetAvailableActions(const AActor* Actor)
+{
+	using namespace FCInteractableDispatchCache;
+
+	const FClassInfo& Info = GetClassInfo(Actor);
+	if (Info.IsNative(EFunc::GetAvailableActions))
+	{
+		return GetInterface<const IIFCInteractablePOI>(Actor, Info.POIOffset)->GetAvailableActions_Implementation();
+	}
+	return IIFCInteractablePOI::Execute_GetAvailableActions(Actor);
+}
+
+void FFCInteractableDispatch::ExecuteAction(AActor* Actor, EFCPOIAction Action, AActor* Interactor)
+{
+	using namespace FCInteractableDispatchCache;
+
+	const FClassInfo& Info = GetClassInfo(Actor);
+	if (Info.IsNative(EFunc::ExecuteAction))
+	{
+		GetInterface<IIFCInteractablePOI>(Actor, Info.POIOffset)->ExecuteAction_Implementation(Action, Interactor);
+		return;
+	}
+	IIFCInteractablePOI::Execute_ExecuteAction(Actor, Action, Interactor);
+}
+
+FString FFCInteractableDispatch::GetPOIName(const AActor* Actor)
+{
+	using namespace FCInteractableDispatchCache;
+
+	const FClassInfo& Info = GetClassInfo(Actor);
+	if (Info.IsNative(EFunc::GetPOIName))
+	{
+		return GetInterface<const IIFCInteractablePOI>(Actor, Info.POIOffset)->GetPOIName_Implementation();
+	}
+	return IIFCInteractablePOI::Execute_GetPOIName(Actor);
+}
+
+bool FFCInteractableDispatch::CanExecuteAction(const AActor* Actor, EFCPOIAction Action, AActor* Interactor)
+{
+	using namespace FCInteractableDispatchCache;
+
+	const FClassInfo& Info = GetClassInfo(Actor);
+	if (Info.IsNative(EFunc::CanExecuteAction))
+	{
+		return GetInterface<const IIFCInteractablePOI>(Actor, Info.POIOffset)->CanExecuteAction_Implementation(Action, Interactor);
+	}
+	return IIFCInteractablePOI::Execute_CanExecuteAction(Actor, Action, Interactor);
+}
+
+// -----------------------------------------------------------------------------
+// Diagnostics
+// -----------------------------------------------------------------------------
+
+bool FFCInteractableDispatch::IsNativeCall(const AActor* Actor, FName FunctionName)
+{
+	using namespace FCInteractableDispatchCache;
+
+	if (!Actor)
+	{
+		return false;
+	}
+
+	const FClassInfo& Info = GetClassInfo(Actor);
+	for (int32 Func = 0; Func < NumFuncs; ++Func)
+	{
+		if (FuncNames[Func] == FunctionName)
+		{
+			return Info.IsNative(static_cast<EFunc>(Func));
+		}
+	}
+	return false;
+}
+
+int32 FFCInteractableDispatch::GetNumCachedClasses()
+{
+	return FCInteractableDispatchCache::ClassInfos.Num();
+}
+
+void FFCInteractableDispatch::ResetCache()
+{
+	using namespace FCInteractableDispatchCache;
+
+	ClassInfos.Reset();
+	LastClass = TObjectKey<UClass>();
+	LastInfo = nullptr;
+}
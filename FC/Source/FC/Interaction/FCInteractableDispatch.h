@@ -0,0 +1,49 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interaction/IFCInteractablePOI.h"
+
+/**
+ * FFCInteractableDispatch - Cached calls into IIFCInteractable / IIFCInteractablePOI
+ *
+ * ImplementsInterface walks the class hierarchy and every Execute_* thunk does a FindFunction
+ * plus ProcessEvent, even when the implementer is plain C++. This resolves both once per class:
+ * which interfaces it supports, where their native subobject sits, and which functions still
+ * resolve to the native _Implementation (no Blueprint override). Those are called directly;
+ * Blueprint-implemented functions keep going through Execute_*.
+ *
+ * Game thread only. Like Execute_*, the call helpers expect the matching Is* check to have passed.
+ */
+class FC_API FFCInteractableDispatch
+{
+public:
+	static bool IsInteractable(const AActor* Actor);
+	static bool IsPOI(const AActor* Actor);
+
+	// --- IIFCInteractable ---------------------------------------------------
+
+	static void OnInteract(AActor* Actor, AActor* Interactor);
+	static FText GetInteractionPrompt(const AActor* Actor);
+	static bool CanInteract(const AActor* Actor, AActor* Interactor);
+	static float GetInteractionRange(const AActor* Actor);
+	static int32 GetInteractionPriority(const AActor* Actor);
+
+	// --- IIFCInteractablePOI ------------------------------------------------
+
+	static TArray<FFCPOIActionData> GetAvailableActions(const AActor* Actor);
+	static void ExecuteAction(AActor* Actor, EFCPOIAction Action, AActor* Interactor);
+	static FString GetPOIName(const AActor* Actor);
+	static bool CanExecuteAction(const AActor* Actor, EFCPOIAction Action, AActor* Interactor);
+
+	// --- Diagnostics --------------------------------------------------------
+
+	/** True if the class of Actor calls Func natively; false for Blueprint overrides or non-implementers */
+	static bool IsNativeCall(const AActor* Actor, FName FunctionName);
+
+	static int32 GetNumCachedClasses();
+
+	/** Drop every cached class (benchmarks; stale classes are otherwise harmless, keys are weak) */
+	static void ResetCache();
+};
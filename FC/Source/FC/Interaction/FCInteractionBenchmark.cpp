@@ -0,0 +1,317 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "AssetRegistry/ARFilter.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Interaction/FCInteractableDispatch.h"
+#include "Interaction/FCInteractionComponent.h"
+#include "Interaction/FCInteractionProfile.h"
+#include "Interaction/IFCInteractable.h"
+#include "UObject/UObjectIterator.h"
+
+/**
+ * FC.InteractionBenchmark [Count=500] [Iterations=20]
+ *
+ * Spawns Count interactables around the player: every native and Blueprint actor class that
+ * implements IFCInteractable / IFCInteractablePOI (Blueprints under /Game/FC/World are loaded
+ * first), interleaved so consecutive lookups never share a class. Then times:
+ *   Reflection - ImplementsInterface + Execute_* thunks on every spawned actor (the old path)
+ *   Dispatch   - the same queries through FFCInteractableDispatch, cache cleared before the first pass
+ *   Trace      - UFCInteractionComponent::DetectInteractablesNow with a synchronous LineTrace profile,
+ *                one call per actor, the actor moved onto the view ray (untimed) before its call
+ *   Overlap    - one DetectInteractablesNow per pass with an OverlapOnly profile reaching every POI
+ * The player's profile is restored and the actors are destroyed afterwards. Interactables must
+ * be side-effect free for these queries.
+ */
+namespace FCInteractionBenchmark
+{
+	/** Spawn disc around the player; the inner gap keeps the view ray and the pawn clear */
+	constexpr float SpawnInnerRadius = 600.f;
+	constexpr float SpawnOuterRadius = 2000.f;
+
+	/** Near face of the traced actor's bounds, in front of the view point (inside the default 200 range) */
+	constexpr float TraceStandoff = 100.f;
+
+	struct FSpawned
+	{
+		AActor* Actor = nullptr;
+		FVector HomeLocation = FVector::ZeroVector;
+
+		/** Actor origin to bounds centre, and bounds radius; for placing it on the view ray */
+		FVector OriginToCenter = FVector::ZeroVector;
+		float BoundsRadius = 0.f;
+	};
+
+	struct FResult
+	{
+		TArray<double> PassMs;
+		double Checksum = 0.0;
+	};
+
+	double Median(TArray<double> Values)
+	{
+		if (Values.Num() == 0)
+		{
+			return 0.0;
+		}
+		Values.Sort();
+		return Values[Values.Num() / 2];
+	}
+
+	template <typename PassFunc>
+	FResult TimePasses(int32 Iterations, PassFunc&& Pass)
+	{
+		FResult Result;
+		Result.PassMs.Reserve(Iterations);
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			const double Start = FPlatformTime::Seconds();
+			Result.Checksum += Pass();
+			Result.PassMs.Add((FPlatformTime::Seconds() - Start) * 1000.0);
+		}
+		return Result;
+	}
+
+	bool IsBenchmarkClass(const UClass* Class)
+	{
+		return Class->IsChildOf(AActor::StaticClass())
+			&& !Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists)
+			&& !Class->GetName().StartsWith(TEXT("SKEL_"))
+			&& (Class->ImplementsInterface(UIFCInteractable::StaticClass()) || Class->ImplementsInterface(UIFCInteractablePOI::StaticClass()));
+	}
+
+	/** Loads the project's world Blueprints, then collects every loaded interactable actor class */
+	void GatherClasses(TArray<UClass*>& OutClasses)
+	{
+		FARFilter Filter;
+		Filter.PackagePaths.Add(TEXT("/Game/FC/World"));
+		Filter.bRecursivePaths = true;
+		Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+		Filter.ClassPaths.Add(UBlueprintGeneratedClass::StaticClass()->GetClassPathName());
+
+		TArray<FAssetData> Assets;
+		IAssetRegistry::GetChecked().GetAssets(Filter, Assets);
+		for (const FAssetData& Asset : Assets)
+		{
+			Asset.GetAsset();
+		}
+
+		for (TObjectIterator<UClass> It; It; ++It)
+		{
+			if (IsBenchmarkClass(*It))
+			{
+				OutClasses.Add(*It);
+			}
+		}
+	}
+
+	void Spawn(UWorld* World, const TArray<UClass*>& Classes, int32 Count, const FVector& Center, TArray<FSpawned>& OutSpawned)
+	{
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		Params.ObjectFlags |= RF_Transient;
+
+		// Sunflower spiral: even density over the disc, class index cycling with the spawn index.
+		const float GoldenAngle = PI * (3.f - FMath::Sqrt(5.f));
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			const float Alpha = FMath::Sqrt((Index + 0.5f) / Count);
+			const float Radius = FMath::Lerp(SpawnInnerRadius, SpawnOuterRadius, Alpha);
+			const float Angle = Index * GoldenAngle;
+			const FVector Location = Center + FVector(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius, 0.f);
+
+			AActor* Actor = World->SpawnActor<AActor>(Classes[Index % Classes.Num()], Location, FRotator::ZeroRotator, Params);
+			if (!Actor)
+			{
+				continue;
+			}
+
+			FVector BoundsOrigin, BoundsExtent;
+			Actor->GetActorBounds(true, BoundsOrigin, BoundsExtent);
+
+			FSpawned& Spawned = OutSpawned.AddDefaulted_GetRef();
+			Spawned.Actor = Actor;
+			Spawned.HomeLocation = Actor->GetActorLocation();
+			Spawned.OriginToCenter = BoundsOrigin - Spawned.HomeLocation;
+			Spawned.BoundsRadius = BoundsExtent.Size();
+		}
+	}
+
+	UFCInteractionProfile* MakeProfile(EFCProbeType ProbeType, float Range)
+	{
+		UFCInteractionProfile* Profile = NewObject<UFCInteractionProfile>(GetTransientPackage());
+		Profile->ProbeType = ProbeType;
+		Profile->Range = Range;
+		Profile->bSynchronousTrace = true;
+		return Profile;
+	}
+
+	void Run(const TArray<FString>& Args, UWorld* World)
+	{
+		const int32 Count = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 500;
+		const int32 Iterations = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 20;
+
+		APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+		UFCInteractionComponent* Interaction = PC ? PC->FindComponentByClass<UFCInteractionComponent>() : nullptr;
+		if (!Interaction)
+		{
+			UE_LOG(LogFCInteraction, Error, TEXT("FC.InteractionBenchmark: no player controller with a UFCInteractionComponent"));
+			return;
+		}
+
+		TArray<UClass*> Classes;
+		GatherClasses(Classes);
+		if (Classes.Num() == 0)
+		{
+			UE_LOG(LogFCInteraction, Error, TEXT("FC.InteractionBenchmark: no IFCInteractable / IFCInteractablePOI actor classes"));
+			return;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		APawn* Pawn = PC->GetPawn();
+		AActor* Interactor = Pawn ? static_cast<AActor*>(Pawn) : PC;
+		const FVector Center = Pawn ? Pawn->GetActorLocation() : ViewLocation;
+
+		TArray<FSpawned> Spawned;
+		Spawn(World, Classes, Count, Center, Spawned);
+		if (Spawned.Num() == 0)
+		{
+			UE_LOG(LogFCInteraction, Error, TEXT("FC.InteractionBenchmark: could not spawn any of the %d classes"), Classes.Num());
+			return;
+		}
+
+		int32 NumNativeClasses = 0;
+		for (const UClass* Class : Classes)
+		{
+			NumNativeClasses += Class->HasAnyClassFlags(CLASS_Native) ? 1 : 0;
+		}
+
+		// The focus log line would dominate every changed-focus call.
+		const ELogVerbosity::Type PreviousVerbosity = LogFCInteraction.GetVerbosity();
+		LogFCInteraction.SetVerbosity(ELogVerbosity::Warning);
+
+		const FResult Reflection = TimePasses(Iterations, [&Spawned, Interactor]()
+		{
+			double Sum = 0.0;
+			for (const FSpawned& Entry : Spawned)
+			{
+				AActor* Actor = Entry.Actor;
+				if (Actor->GetClass()->ImplementsInterface(UIFCInteractable::StaticClass()))
+				{
+					Sum += IIFCInteractable::Execute_GetInteractionRange(Actor);
+					Sum += IIFCInteractable::Execute_CanInteract(Actor, Interactor) ? 1.0 : 0.0;
+				}
+				else if (Actor->GetClass()->ImplementsInterface(UIFCInteractablePOI::StaticClass()))
+				{
+					Sum += IIFCInteractablePOI::Execute_GetPOIName(Actor).Len();
+				}
+			}
+			return Sum;
+		});
+
+		FFCInteractableDispatch::ResetCache();
+		const FResult Dispatch = TimePasses(Iterations, [&Spawned, Interactor]()
+		{
+			double Sum = 0.0;
+			for (const FSpawned& Entry : Spawned)
+			{
+				AActor* Actor = Entry.Actor;
+				if (FFCInteractableDispatch::IsInteractable(Actor))
+				{
+					Sum += FFCInteractableDispatch::GetInteractionRange(Actor);
+					Sum += FFCInteractableDispatch::CanInteract(Actor, Interactor) ? 1.0 : 0.0;
+				}
+				else if (FFCInteractableDispatch::IsPOI(Actor))
+				{
+					Sum += FFCInteractableDispatch::GetPOIName(Actor).Len();
+				}
+			}
+			return Sum;
+		});
+
+		UFCInteractionProfile* PreviousProfile = Interaction->GetActiveProfile();
+
+		// Trace: the real focus check, one per actor, against a different class each call.
+		Interaction->ApplyInteractionProfile(MakeProfile(EFCProbeType::LineTrace, 500.f));
+		const FVector ViewDirection = ViewRotation.Vector();
+		int32 TraceFocusHits = 0;
+		FResult Trace;
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			double PassSeconds = 0.0;
+			for (const FSpawned& Entry : Spawned)
+			{
+				const FVector BoundsCenter = ViewLocation + ViewDirection * (TraceStandoff + Entry.BoundsRadius);
+				Entry.Actor->SetActorLocation(BoundsCenter - Entry.OriginToCenter, false, nullptr, ETeleportType::TeleportPhysics);
+
+				const double Start = FPlatformTime::Seconds();
+				const AActor* Focus = Interaction->DetectInteractablesNow();
+				PassSeconds += FPlatformTime::Seconds() - Start;
+
+				TraceFocusHits += Focus == Entry.Actor ? 1 : 0;
+				Entry.Actor->SetActorLocation(Entry.HomeLocation, false, nullptr, ETeleportType::TeleportPhysics);
+			}
+			Trace.PassMs.Add(PassSeconds * 1000.0);
+		}
+
+		// Overlap: every spawned POI is a registry candidate of a single check.
+		Interaction->ApplyInteractionProfile(MakeProfile(EFCProbeType::OverlapOnly, SpawnOuterRadius + 100.f));
+		const FResult Overlap = TimePasses(Iterations, [Interaction]()
+		{
+			return Interaction->DetectInteractablesNow() ? 1.0 : 0.0;
+		});
+
+		Interaction->ApplyInteractionProfile(PreviousProfile);
+		LogFCInteraction.SetVerbosity(PreviousVerbosity);
+
+		int32 NumPOIs = 0;
+		for (const FSpawned& Entry : Spawned)
+		{
+			NumPOIs += FFCInteractableDispatch::IsPOI(Entry.Actor) ? 1 : 0;
+			Entry.Actor->Destroy();
+		}
+
+		const int32 NumSpawned = Spawned.Num();
+		const double ReflectionMs = Median(Reflection.PassMs);
+		const double DispatchMs = Median(Dispatch.PassMs);
+		const double TraceMs = Median(Trace.PassMs);
+		const double OverlapMs = Median(Overlap.PassMs);
+
+		UE_LOG(LogFCInteraction, Display,
+			TEXT("FC.InteractionBenchmark: %d actors of %d classes (%d native), %d POIs, %d passes"),
+			NumSpawned, Classes.Num(), NumNativeClasses, NumPOIs, Iterations);
+		UE_LOG(LogFCInteraction, Display, TEXT("  Reflection  %.3f ms/pass  %.1f ns/actor  (first pass %.3f ms)"),
+			ReflectionMs, ReflectionMs * 1.0e6 / NumSpawned, Reflection.PassMs[0]);
+		UE_LOG(LogFCInteraction, Display, TEXT("  Dispatch    %.3f ms/pass  %.1f ns/actor  (first pass %.3f ms)  x%.2f"),
+			DispatchMs, DispatchMs * 1.0e6 / NumSpawned, Dispatch.PassMs[0], DispatchMs > 0.0 ? ReflectionMs / DispatchMs : 0.0);
+		UE_LOG(LogFCInteraction, Display, TEXT("  Trace       %.3f ms/pass  %.2f us/check  (focus on target %d of %d checks)"),
+			TraceMs, TraceMs * 1.0e3 / NumSpawned, TraceFocusHits, NumSpawned * Iterations);
+		UE_LOG(LogFCInteraction, Display, TEXT("  Overlap     %.3f ms/check over %d POIs  (focus found %.0f of %d checks)"),
+			OverlapMs, NumPOIs, Overlap.Checksum, Iterations);
+
+		if (Reflection.Checksum != Dispatch.Checksum)
+		{
+			UE_LOG(LogFCInteraction, Warning, TEXT("FC.InteractionBenchmark: results differ between paths (%.1f vs %.1f)"),
+				Reflection.Checksum, Dispatch.Checksum);
+		}
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs InteractionBenchmarkCommand(
+		TEXT("FC.InteractionBenchmark"),
+		TEXT("Spawn mixed native/Blueprint interactables and time interface dispatch and DetectInteractables. Args: [Count=500] [Iterations=20]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&Run));
+}
+
+#endif // !UE_BUILD_SHIPPING
@@ -18,7 +18,9 @@
 #include "FCInteractionComponent.h"
 #include "IFCInteractable.h"
 #include "IFCInteractablePOI.h"
+#include "Interaction/FCInteractableDispatch.h"
 #include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerController.h"
 #include "Camera/CameraComponent.h"
 #include "Blueprint/UserWidget.h"
@@ -30,6 +32,9 @@
 #include "Components/FCCameraManager.h"
 #include "Characters/Convoy/FCOverworldConvoy.h"
 #include "Interaction/FCInteractionProfile.h"
+#include "UI/FCInteractionPromptWidget.h"
+#include "World/FCOverworldPOI.h"
+#include "World/FCOverworldPOIRegistry.h"
 
 DEFINE_LOG_CATEGORY(LogFCInteraction);
 
@@ -77,6 +82,16 @@ void UFCInteractionComponent::BeginPlay()
 			InteractionPromptWidget->SetVisibility(ESlateVisibility::Hidden);
 			InteractionPromptWidget->AddToViewport();
 			UE_LOG(LogFCInteraction, Log, TEXT("Interaction prompt widget created and added to viewport"));
+
+			// Legacy widgets: resolve the Blueprint setter once instead of per prompt update.
+			if (!InteractionPromptWidget->IsA<UFCInteractionPromptWidget>())
+			{
+				LegacySetPromptFunction = InteractionPromptWidget->FindFunction(FName("SetInteractionPrompt"));
+				UE_LOG(LogFCInteraction, Warning,
+					TEXT("%s does not derive from UFCInteractionPromptWidget; using the legacy SetInteractionPrompt path%s"),
+					*GetNameSafe(InteractionPromptWidgetClass.Get()),
+					LegacySetPromptFunction ? TEXT("") : TEXT(" (function missing, prompt text will not show)"));
+			}
 		}
 		else
 		{
@@ -89,6 +104,13 @@ void UFCInteractionComponent::BeginPlay()
 	}
 }
 
+void UFCInteractionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	BindOverlapPawn(nullptr);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UFCInteractionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
@@ -98,12 +120,18 @@ void UFCInteractionComponent::TickComponent(float DeltaTime, ELevelTick TickType
 		return;
 	}
 
-    if (!bFirstPersonFocusEnabled)
+    if (!bFocusEnabled)
     {
-        // Setter already cleared focus when disabled; no trace or prompt updates in non-FP modes.
+        // Setter already cleared focus when disabled; no probes or prompt updates in modes without focus.
         return;
     }
 
+	// Async traces from an earlier check land here, one frame after submission.
+	if (ConsumeAsyncProbes())
+	{
+		UpdatePromptWidget();
+	}
+
 	// Rate-limit interaction checks for performance
 	InteractionCheckTimer += DeltaTime;
 	if (InteractionCheckTimer >= InteractionCheckFrequency)
@@ -139,106 +167,394 @@ void UFCInteractionComponent::DetectInteractables()
 		return;
 	}
 
-	// Resolve interaction profile to drive trace config.
-    UFCInteractionProfile* Profile = GetEffectiveProfile();
+	// Resolve interaction profile to drive probe config (no profile = legacy line trace).
+	const UFCInteractionProfile* Profile = GetEffectiveProfile();
+	const EFCProbeType ProbeType = Profile ? Profile->ProbeType : EFCProbeType::LineTrace;
 
-    // Get camera location and direction
-    FVector CameraLocation;
-    FRotator CameraRotation;
-    PC->GetPlayerViewPoint(CameraLocation, CameraRotation);
+	if (ProbeType != EFCProbeType::OverlapOnly && OverlapPawn.IsValid())
+	{
+		BindOverlapPawn(nullptr);
+	}
 
-    const float Range = Profile ? Profile->Range : InteractionTraceDistance;
-    ECollisionChannel Channel = ECC_Visibility;
-	if (Profile)
+	AActor* NewFocus = nullptr;
+	switch (ProbeType)
 	{
-		Channel = static_cast<ECollisionChannel>(Profile->TraceChannel.GetValue());
+	case EFCProbeType::LineTrace:
+	case EFCProbeType::SphereTrace:
+		if (!Profile || !Profile->bSynchronousTrace)
+		{
+			// Result is applied by ConsumeAsyncProbes next frame.
+			SubmitAsyncProbe(PC, Profile, ProbeType == EFCProbeType::SphereTrace);
+			return;
+		}
+		NewFocus = ProbeTrace(PC, Profile, ProbeType == EFCProbeType::SphereTrace);
+		break;
+	case EFCProbeType::CursorHit:
+		NewFocus = ProbeCursor(PC, Profile);
+		break;
+	case EFCProbeType::OverlapOnly:
+		NewFocus = ProbeOverlaps(PC, Profile);
+		break;
 	}
 
-    const FVector TraceEnd = CameraLocation + (CameraRotation.Vector() * Range);
+	SetFocusedInteractable(NewFocus);
+}
+
+AActor* UFCInteractionComponent::DetectInteractablesNow()
+{
+	DetectInteractables();
+	return CurrentInteractable.Get();
+}
+
+UFCInteractionComponent::FProbeTrace UFCInteractionComponent::BuildProbeTrace(AFCPlayerController* PC, const UFCInteractionProfile* Profile, bool bSphere) const
+{
+	// Get camera location and direction
+	FVector CameraLocation;
+	FRotator CameraRotation;
+	PC->GetPlayerViewPoint(CameraLocation, CameraRotation);
+
+	const float Range = Profile ? Profile->Range : InteractionTraceDistance;
+
+	FProbeTrace Trace;
+	Trace.Start = CameraLocation;
+	Trace.End = CameraLocation + (CameraRotation.Vector() * Range);
+	Trace.Channel = Profile ? static_cast<ECollisionChannel>(Profile->TraceChannel.GetValue()) : ECC_Visibility;
+	// A zero radius sweep is just a line trace; keep the cheaper query.
+	Trace.Radius = (bSphere && Profile) ? FMath::Max(Profile->Radius, 0.f) : 0.f;
+
+	Trace.Params = FCollisionQueryParams(SCENE_QUERY_STAT(FCInteractionProbe), false);
+	Trace.Params.AddIgnoredActor(GetOwner());
+	Trace.Params.AddIgnoredActor(PC->GetPawn()); // sweeps start inside the pawn in first person
+	return Trace;
+}
+
+AActor* UFCInteractionComponent::ProbeTrace(AFCPlayerController* PC, const UFCInteractionProfile* Profile, bool bSphere)
+{
+	const FProbeTrace Trace = BuildProbeTrace(PC, Profile, bSphere);
 
-    // Perform line trace (probe type = LineTrace for now; extend later if needed).
-    FHitResult HitResult;
-    FCollisionQueryParams QueryParams;
-    QueryParams.AddIgnoredActor(OwnerActor);
+	FHitResult HitResult;
+	const bool bHit = Trace.Radius > 0.f
+		? GetWorld()->SweepSingleByChannel(HitResult, Trace.Start, Trace.End, FQuat::Identity, Trace.Channel, FCollisionShape::MakeSphere(Trace.Radius), Trace.Params)
+		: GetWorld()->LineTraceSingleByChannel(HitResult, Trace.Start, Trace.End, Trace.Channel, Trace.Params);
 
-    const bool bHit = GetWorld()->LineTraceSingleByChannel(
-        HitResult,
-        CameraLocation,
-        TraceEnd,
-        Channel,
-        QueryParams
-    );
+	return ResolveTraceHit(Trace, bHit ? &HitResult : nullptr, Profile);
+}
 
+AActor* UFCInteractionComponent::ResolveTraceHit(const FProbeTrace& Trace, const FHitResult* Hit, const UFCInteractionProfile* Profile)
+{
 	// Debug visualization
 	if (bShowDebugTrace)
 	{
-		DrawDebugLine(GetWorld(), CameraLocation, TraceEnd, bHit ? FColor::Green : FColor::Red, false, InteractionCheckFrequency, 0, 2.0f);
-		if (bHit)
+		DrawDebugLine(GetWorld(), Trace.Start, Trace.End, Hit ? FColor::Green : FColor::Red, false, InteractionCheckFrequency, 0, 2.0f);
+		if (Trace.Radius > 0.f)
+		{
+			DrawDebugSphere(GetWorld(), Hit ? Hit->Location : Trace.End, Trace.Radius, 12, FColor::Cyan, false, InteractionCheckFrequency);
+		}
+		if (Hit)
 		{
-			DrawDebugSphere(GetWorld(), HitResult.ImpactPoint, 10.0f, 8, FColor::Yellow, false, InteractionCheckFrequency);
+			DrawDebugSphere(GetWorld(), Hit->ImpactPoint, 10.0f, 8, FColor::Yellow, false, InteractionCheckFrequency);
 		}
 	}
 
-	// Check if we hit an interactable
-    if (bHit && HitResult.GetActor())
-    {
-        AActor* HitActor = HitResult.GetActor();
+	if (!Hit)
+	{
+		return nullptr;
+	}
 
-        // Optional tag filtering from profile
-        if (Profile && Profile->AllowedTags.Num() > 0)
-        {
-            bool bTagOk = false;
-            for (const FName Tag : Profile->AllowedTags)
-            {
-                if (HitActor->ActorHasTag(Tag))
-                {
-                    bTagOk = true;
-                    break;
-                }
-            }
-
-            if (!bTagOk)
-            {
-                // Ignore this hit completely if it does not match the profile's tag filter.
-                CurrentInteractable = nullptr;
-                return;
-            }
-        }
+	AActor* HitActor = Hit->GetActor();
+	const float Distance = FVector::Dist(Trace.Start, Hit->ImpactPoint);
+	return IsValidFocusCandidate(HitActor, Distance, Profile) ? HitActor : nullptr;
+}
 
-        // Check if the actor implements the interactable interface
-        if (HitActor->GetClass()->ImplementsInterface(UIFCInteractable::StaticClass()))
-        {
-            // Check if within interaction range (per-object); still using the interface range.
-            const float InteractionRange = IIFCInteractable::Execute_GetInteractionRange(HitActor);
-            const float Distance = FVector::Dist(CameraLocation, HitResult.ImpactPoint);
-
-            if (Distance <= InteractionRange)
-            {
-                const bool bCanInteract = IIFCInteractable::Execute_CanInteract(HitActor, OwnerActor);
-
-                if (bCanInteract)
-                {
-                    if (CurrentInteractable != HitActor)
-                    {
-                        CurrentInteractable = HitActor;
-                        UE_LOG(LogFCInteraction, Log,
-                            TEXT("New interactable in focus: %s"),
-                            *HitActor->GetName());
-                    }
-                    return;
-                }
-            }
-        }
-    }
+void UFCInteractionComponent::SubmitAsyncProbe(AFCPlayerController* PC, const UFCInteractionProfile* Profile, bool bSphere)
+{
+	// Ring full (hitch or a check every frame): the oldest request is dropped.
+	if (NumPendingProbes == MaxPendingProbes)
+	{
+		PendingProbeHead = (PendingProbeHead + 1) % MaxPendingProbes;
+		--NumPendingProbes;
+	}
+
+	FPendingProbe& Pending = PendingProbes[(PendingProbeHead + NumPendingProbes) % MaxPendingProbes];
+	Pending.Trace = BuildProbeTrace(PC, Profile, bSphere);
+	Pending.Profile = Profile;
+
+	const FProbeTrace& Trace = Pending.Trace;
+	Pending.Handle = Trace.Radius > 0.f
+		? GetWorld()->AsyncSweepByChannel(EAsyncTraceType::Single, Trace.Start, Trace.End, FQuat::Identity, Trace.Channel, FCollisionShape::MakeSphere(Trace.Radius), Trace.Params)
+		: GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, Trace.Start, Trace.End, Trace.Channel, Trace.Params);
+
+	++NumPendingProbes;
+}
+
+bool UFCInteractionComponent::ConsumeAsyncProbes()
+{
+	if (NumPendingProbes == 0)
+	{
+		return false;
+	}
+
+	UWorld* World = GetWorld();
+
+	// Oldest first; the newest finished trace decides focus.
+	const FPendingProbe* Latest = nullptr;
+	FTraceDatum LatestData;
+	FTraceDatum Data;
+	while (NumPendingProbes > 0)
+	{
+		const FPendingProbe& Pending = PendingProbes[PendingProbeHead];
+		if (World->QueryTraceData(Pending.Handle, Data))
+		{
+			Latest = &Pending;
+			Swap(LatestData, Data);
+		}
+		else if (World->IsTraceHandleValid(Pending.Handle, false))
+		{
+			break; // submitted this frame; results arrive next frame
+		}
+
+		// Consumed, or expired (results only live for the frame after submission).
+		PendingProbeHead = (PendingProbeHead + 1) % MaxPendingProbes;
+		--NumPendingProbes;
+	}
+
+	if (!Latest)
+	{
+		return false;
+	}
+
+	// UI may have opened since the request went out.
+	const AFCPlayerController* PC = GetOwnerPCCheckedOrNull();
+	if (!PC || !PC->CanWorldInteract())
+	{
+		SetFocusedInteractable(nullptr);
+		return true;
+	}
+
+	const FHitResult* Hit = nullptr;
+	for (const FHitResult& Candidate : LatestData.OutHits)
+	{
+		if (Candidate.bBlockingHit)
+		{
+			Hit = &Candidate;
+			break;
+		}
+	}
+
+	SetFocusedInteractable(ResolveTraceHit(Latest->Trace, Hit, Latest->Profile.Get()));
+	return true;
+}
+
+void UFCInteractionComponent::ResetAsyncProbes()
+{
+	PendingProbeHead = 0;
+	NumPendingProbes = 0;
+}
+
+AActor* UFCInteractionComponent::ProbeCursor(AFCPlayerController* PC, const UFCInteractionProfile* Profile)
+{
+	const float Range = Profile ? Profile->Range : InteractionTraceDistance;
+	const ECollisionChannel Channel = Profile ? static_cast<ECollisionChannel>(Profile->TraceChannel.GetValue()) : ECC_Visibility;
+
+	FHitResult HitResult;
+	if (!PC->GetHitResultUnderCursor(Channel, false, HitResult) || !HitResult.GetActor())
+	{
+		return nullptr;
+	}
+
+	// Cursor hits come from a distant camera; reach is measured from the interactor instead.
+	const APawn* Pawn = PC->GetPawn();
+	const FVector Origin = Pawn ? Pawn->GetActorLocation() : HitResult.TraceStart;
+	const float Distance = FVector::Dist(Origin, HitResult.ImpactPoint);
+
+	if (bShowDebugTrace)
+	{
+		DrawDebugSphere(GetWorld(), HitResult.ImpactPoint, 10.0f, 8, Distance <= Range ? FColor::Yellow : FColor::Red, false, InteractionCheckFrequency);
+	}
+
+	if (Distance > Range)
+	{
+		return nullptr;
+	}
+
+	AActor* HitActor = HitResult.GetActor();
+	return IsValidFocusCandidate(HitActor, Distance, Profile) ? HitActor : nullptr;
+}
+
+AActor* UFCInteractionComponent::ProbeOverlaps(AFCPlayerController* PC, const UFCInteractionProfile* Profile)
+{
+	APawn* Pawn = PC->GetPawn();
+	if (OverlapPawn.Get() != Pawn)
+	{
+		BindOverlapPawn(Pawn);
+	}
+
+	if (!Pawn)
+	{
+		return nullptr;
+	}
+
+	const float Range = Profile ? Profile->Range : InteractionTraceDistance;
+	const FVector Origin = Pawn->GetActorLocation();
+
+	// Highest GetInteractionPriority wins, nearest breaks ties.
+	AActor* BestActor = nullptr;
+	int32 BestPriority = MIN_int32;
+	float BestDistance = 0.f;
+
+	auto ConsiderCandidate = [&](AActor* Candidate)
+	{
+		if (!Candidate || Candidate == BestActor)
+		{
+			return;
+		}
+
+		const float Distance = FVector::Dist(Origin, Candidate->GetActorLocation());
+		if (Distance > Range || !IsValidFocusCandidate(Candidate, Distance, Profile))
+		{
+			return;
+		}
+
+		const int32 Priority = FFCInteractableDispatch::IsInteractable(Candidate) ? FFCInteractableDispatch::GetInteractionPriority(Candidate) : 0;
+		if (!BestActor || Priority > BestPriority || (Priority == BestPriority && Distance < BestDistance))
+		{
+			BestActor = Candidate;
+			BestPriority = Priority;
+			BestDistance = Distance;
+		}
+	};
+
+	// Actors the pawn already overlaps (kept up to date by overlap events, no query here).
+	for (const TWeakObjectPtr<AActor>& Candidate : OverlapCandidates)
+	{
+		ConsiderCandidate(Candidate.Get());
+	}
+
+	// Overworld POIs within reach, straight from the spatial registry.
+	if (const UFCOverworldPOIRegistry* Registry = GetWorld()->GetSubsystem<UFCOverworldPOIRegistry>())
+	{
+		Registry->ForEachInRadius(FVector2D(Origin), Range, [&ConsiderCandidate](AFCOverworldPOI* POI, float DistanceSq)
+		{
+			ConsiderCandidate(POI);
+		});
+	}
+
+	if (bShowDebugTrace)
+	{
+		DrawDebugCircle(GetWorld(), Origin, Range, 32, BestActor ? FColor::Green : FColor::Red, false, InteractionCheckFrequency, 0, 2.0f, FVector::XAxisVector, FVector::YAxisVector, false);
+	}
+
+	return BestActor;
+}
+
+bool UFCInteractionComponent::IsValidFocusCandidate(AActor* Candidate, float Distance, const UFCInteractionProfile* Profile) const
+{
+	if (!Candidate)
+	{
+		return false;
+	}
+
+	// Optional tag filtering from profile
+	if (Profile && Profile->AllowedTags.Num() > 0)
+	{
+		bool bTagOk = false;
+		for (const FName Tag : Profile->AllowedTags)
+		{
+			if (Candidate->ActorHasTag(Tag))
+			{
+				bTagOk = true;
+				break;
+			}
+		}
+
+		if (!bTagOk)
+		{
+			return false;
+		}
+	}
+
+	// Interactables: within their own interaction range and currently usable
+	if (FFCInteractableDispatch::IsInteractable(Candidate))
+	{
+		return Distance <= FFCInteractableDispatch::GetInteractionRange(Candidate)
+			&& FFCInteractableDispatch::CanInteract(Candidate, GetOwner());
+	}
+
+	// POIs (overworld / camp) have no range of their own; the probe's Range already applied.
+	// Their actions are checked when the player interacts (HandlePOIClick).
+	return FFCInteractableDispatch::IsPOI(Candidate);
+}
+
+FText UFCInteractionComponent::GetFocusPrompt(AActor* FocusActor) const
+{
+	if (FFCInteractableDispatch::IsInteractable(FocusActor))
+	{
+		return FFCInteractableDispatch::GetInteractionPrompt(FocusActor);
+	}
+	return FText::FromString(FFCInteractableDispatch::GetPOIName(FocusActor));
+}
+
+void UFCInteractionComponent::SetFocusedInteractable(AActor* NewFocus)
+{
+	if (NewFocus)
+	{
+		if (CurrentInteractable != NewFocus)
+		{
+			CurrentInteractable = NewFocus;
+			UE_LOG(LogFCInteraction, Log, TEXT("New interactable in focus: %s"), *NewFocus->GetName());
+		}
+		return;
+	}
 
 	// No valid interactable found
 	if (CurrentInteractable.IsValid())
 	{
 		UE_LOG(LogFCInteraction, Verbose, TEXT("Lost focus on interactable"));
-		CurrentInteractable = nullptr;
+	}
+	CurrentInteractable = nullptr;
+}
+
+void UFCInteractionComponent::BindOverlapPawn(APawn* Pawn)
+{
+	if (APawn* OldPawn = OverlapPawn.Get())
+	{
+		OldPawn->OnActorBeginOverlap.RemoveDynamic(this, &UFCInteractionComponent::HandleOverlapPawnBeginOverlap);
+		OldPawn->OnActorEndOverlap.RemoveDynamic(this, &UFCInteractionComponent::HandleOverlapPawnEndOverlap);
+	}
+
+	OverlapPawn = Pawn;
+	OverlapCandidates.Reset();
+
+	if (!Pawn)
+	{
+		return;
+	}
+
+	Pawn->OnActorBeginOverlap.AddDynamic(this, &UFCInteractionComponent::HandleOverlapPawnBeginOverlap);
+	Pawn->OnActorEndOverlap.AddDynamic(this, &UFCInteractionComponent::HandleOverlapPawnEndOverlap);
+
+	// Seed from the pawn's current overlap list (already maintained by the engine, not a query).
+	TArray<AActor*> Overlapping;
+	Pawn->GetOverlappingActors(Overlapping);
+	for (AActor* Actor : Overlapping)
+	{
+		OverlapCandidates.Add(Actor);
 	}
 }
 
+void UFCInteractionComponent::HandleOverlapPawnBeginOverlap(AActor* OverlappedActor, AActor* OtherActor)
+{
+	if (OtherActor)
+	{
+		OverlapCandidates.Add(OtherActor);
+	}
+}
+
+void UFCInteractionComponent::HandleOverlapPawnEndOverlap(AActor* OverlappedActor, AActor* OtherActor)
+{
+	OverlapCandidates.Remove(OtherActor);
+}
+
 void UFCInteractionComponent::UpdatePromptWidget()
 {
 	if (!InteractionPromptWidget)
@@ -246,34 +562,72 @@ void UFCInteractionComponent::UpdatePromptWidget()
 		return;
 	}
 
-	if (CurrentInteractable.IsValid())
-	{
-		// Get the prompt text from the interactable
-		FText PromptText = IIFCInteractable::Execute_GetInteractionPrompt(CurrentInteractable.Get());
+	AActor* FocusActor = CurrentInteractable.Get();
+	UFCInteractionPromptWidget* NativePrompt = Cast<UFCInteractionPromptWidget>(InteractionPromptWidget);
 
-		// Call the widget's SetInteractionPrompt function (must exist in blueprint)
-		UFunction* SetPromptFunction = InteractionPromptWidget->FindFunction(FName("SetInteractionPrompt"));
-		if (SetPromptFunction)
-		{
-			InteractionPromptWidget->ProcessEvent(SetPromptFunction, &PromptText);
-		}
-		else
+	// Steady focus: the native widget follows its target by itself; legacy widgets only get moved.
+	// (A destroyed prompt actor reads as null too, hence the shown flag.)
+	if (FocusActor == PromptActor.Get() && (FocusActor != nullptr) == bPromptShown)
+	{
+		if (FocusActor && !NativePrompt)
 		{
-			UE_LOG(LogFCInteraction, Warning, TEXT("WBP_InteractionPrompt is missing SetInteractionPrompt function"));
+			UpdateLegacyPromptPosition(FocusActor);
 		}
+		return;
+	}
 
-		// Position the widget at the interactable's screen position
-		AFCPlayerController* PC = GetOwnerPCCheckedOrNull();
-		if (!PC) { return; }
+	PromptActor = FocusActor;
 
-		FVector WorldPos = CurrentInteractable->GetActorLocation();
-		FVector2D ScreenPos;
-		if (PC->ProjectWorldLocationToScreen(WorldPos, ScreenPos))
-		{
-			InteractionPromptWidget->SetPositionInViewport(ScreenPos);
-		}
+	if (!FocusActor)
+	{
+		HidePromptWidget();
+		return;
+	}
 
-		InteractionPromptWidget->SetVisibility(ESlateVisibility::Visible);
+	// Focus changed: fetch and push the prompt text once.
+	bPromptShown = true;
+	FText PromptText = GetFocusPrompt(FocusActor);
+
+	if (NativePrompt)
+	{
+		NativePrompt->ShowPrompt(FocusActor, PromptText);
+		return;
+	}
+
+	if (LegacySetPromptFunction)
+	{
+		InteractionPromptWidget->ProcessEvent(LegacySetPromptFunction, &PromptText);
+	}
+	UpdateLegacyPromptPosition(FocusActor);
+	InteractionPromptWidget->SetVisibility(ESlateVisibility::Visible);
+}
+
+void UFCInteractionComponent::UpdateLegacyPromptPosition(const AActor* FocusActor)
+{
+	// Position the widget at the interactable's screen position
+	AFCPlayerController* PC = GetOwnerPCCheckedOrNull();
+	if (!PC) { return; }
+
+	FVector2D ScreenPos;
+	if (PC->ProjectWorldLocationToScreen(FocusActor->GetActorLocation(), ScreenPos))
+	{
+		InteractionPromptWidget->SetPositionInViewport(ScreenPos);
+	}
+}
+
+void UFCInteractionComponent::HidePromptWidget()
+{
+	PromptActor.Reset();
+	bPromptShown = false;
+
+	if (!InteractionPromptWidget)
+	{
+		return;
+	}
+
+	if (UFCInteractionPromptWidget* NativePrompt = Cast<UFCInteractionPromptWidget>(InteractionPromptWidget))
+	{
+		NativePrompt->HidePrompt();
 	}
 	else
 	{
@@ -291,8 +645,16 @@ void UFCInteractionComponent::Interact()
 
 	AActor* InteractableActor = CurrentInteractable.Get();
 
+	// Focused POI (OverlapOnly / CursorHit in camp or overworld): same flow as clicking it.
+	if (!FFCInteractableDispatch::IsInteractable(InteractableActor))
+	{
+		HandlePOIClick(InteractableActor);
+		PromptActor.Reset();
+		return;
+	}
+
 	// Double-check that we can still interact (conditions may have changed)
-	bool bCanInteract = IIFCInteractable::Execute_CanInteract(InteractableActor, GetOwner());
+	bool bCanInteract = FFCInteractableDispatch::CanInteract(InteractableActor, GetOwner());
 	if (!bCanInteract)
 	{
 		UE_LOG(LogFCInteraction, Warning, TEXT("Cannot interact with %s (conditions not met)"), *InteractableActor->GetName());
@@ -301,7 +663,10 @@ void UFCInteractionComponent::Interact()
 
 	// Execute the interaction
 	UE_LOG(LogFCInteraction, Log, TEXT("Interacting with: %s"), *InteractableActor->GetName());
-	IIFCInteractable::Execute_OnInteract(InteractableActor, GetOwner());
+	FFCInteractableDispatch::OnInteract(InteractableActor, GetOwner());
+
+	// The prompt may read differently now ("Open" -> "Close"); re-push it on the next update.
+	PromptActor.Reset();
 }
 
 void UFCInteractionComponent::HandlePOIClick(AActor* POIActor)
@@ -321,14 +686,14 @@ void UFCInteractionComponent::HandlePOIClick(AActor* POIActor)
 	bPendingPOIAlreadyReached = false;
 
 	// Query available actions via POI interface.
-	if (!POIActor->GetClass()->ImplementsInterface(UIFCInteractablePOI::StaticClass()))
+	if (!FFCInteractableDispatch::IsPOI(POIActor))
 	{
 		UE_LOG(LogFCInteraction, Warning, TEXT("[Interaction] Clicked actor %s is not a POI"), *GetNameSafe(POIActor));
 		return;
 	}
 
-	const TArray<FFCPOIActionData> AvailableActions = IIFCInteractablePOI::Execute_GetAvailableActions(POIActor);
-	const FString POIName = IIFCInteractablePOI::Execute_GetPOIName(POIActor);
+	const TArray<FFCPOIActionData> AvailableActions = FFCInteractableDispatch::GetAvailableActions(POIActor);
+	const FString POIName = FFCInteractableDispatch::GetPOIName(POIActor);
 
 	UE_LOG(LogFCInteraction, Log, TEXT("[Interaction] POI click on '%s', %d actions available"), *POIName, AvailableActions.Num());
 
@@ -483,13 +848,13 @@ void UFCInteractionComponent::NotifyPOIOverlap(AActor* POIActor)
 
 	UE_LOG(LogFCInteraction, Log, TEXT("NotifyPOIOverlap received: %s"), *GetNameSafe(POIActor));
 
-	// Robust interface check (works for BP implementations too)
-	if (!POIActor->GetClass()->ImplementsInterface(UIFCInteractablePOI::StaticClass()))
+	// Cached per class; covers BP implementations too
+	if (!FFCInteractableDispatch::IsPOI(POIActor))
 	{
 		return;
 	}
 
-	const FString POIName = IIFCInteractablePOI::Execute_GetPOIName(POIActor);
+	const FString POIName = FFCInteractableDispatch::GetPOIName(POIActor);
 
 	// Pending execution path: execute ONLY if this is our pending POI and we have a selected action.
 	if (PendingPOI.IsValid() && PendingPOI.Get() == POIActor && PendingAction.IsSet() && !bAwaitingSelection)
@@ -499,7 +864,7 @@ void UFCInteractionComponent::NotifyPOIOverlap(AActor* POIActor)
 	}
 
 	// Unintentional overlap (exploration, fleeing, enemy chase)
-	const TArray<FFCPOIActionData> AvailableActions = IIFCInteractablePOI::Execute_GetAvailableActions(POIActor);
+	const TArray<FFCPOIActionData> AvailableActions = FFCInteractableDispatch::GetAvailableActions(POIActor);
 
 	if (AvailableActions.Num() == 0)
 	{
@@ -574,16 +939,16 @@ void UFCInteractionComponent::NotifyArrivedAtPOI(AActor* POIActor)
 
 
 
-void UFCInteractionComponent::SetFirstPersonFocusEnabled(bool bEnabled)
+void UFCInteractionComponent::SetFocusEnabled(bool bEnabled)
 {
-    if (bFirstPersonFocusEnabled == bEnabled)
+    if (bFocusEnabled == bEnabled)
     {
         return;
     }
 
-    bFirstPersonFocusEnabled = bEnabled;
+    bFocusEnabled = bEnabled;
 
-    if (!bFirstPersonFocusEnabled)
+    if (!bFocusEnabled)
     {
         ClearFocusAndHidePrompt();
     }
@@ -593,11 +958,8 @@ void UFCInteractionComponent::ClearFocusAndHidePrompt()
 {
     // Use your actual member names for current focus + prompt widget.
     CurrentInteractable = nullptr;
-
-    if (InteractionPromptWidget)
-    {
-        InteractionPromptWidget->SetVisibility(ESlateVisibility::Hidden);
-    }
+    ResetAsyncProbes();
+    HidePromptWidget();
 }
 
 EFCInteractionPhase UFCInteractionComponent::GetCurrentInteractionPhase() const
@@ -629,7 +991,7 @@ void UFCInteractionComponent::ResetInteractionState()
 
 void UFCInteractionComponent::ExecutePOIActionNow(AActor* POIActor, EFCPOIAction Action)
 {
-	if (!IsValid(POIActor) || !POIActor->GetClass()->ImplementsInterface(UIFCInteractablePOI::StaticClass()))
+	if (!IsValid(POIActor) || !FFCInteractableDispatch::IsPOI(POIActor))
 	{
 		UE_LOG(LogFCInteraction, Warning, TEXT("[Interaction] ExecutePOIActionNow ignored (invalid POI)"));
 		return;
@@ -641,7 +1003,7 @@ void UFCInteractionComponent::ExecutePOIActionNow(AActor* POIActor, EFCPOIAction
 	UE_LOG(LogFCInteraction, Log, TEXT("[Interaction] Executing action %s on POI %s"),
 		*UEnum::GetValueAsString(Action), *GetNameSafe(POIActor));
 
-	IIFCInteractablePOI::Execute_ExecuteAction(POIActor, Action, GetOwner());
+	FFCInteractableDispatch::ExecuteAction(POIActor, Action, GetOwner());
 
 	// Preserve your existing convoy gate cleanup where applicable
 	if (AFCPlayerController* PC = GetOwnerPCCheckedOrNull())
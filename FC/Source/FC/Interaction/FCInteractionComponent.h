@@ -4,12 +4,16 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "CollisionQueryParams.h"
+#include "WorldCollision.h"
 #include "IFCInteractablePOI.h"
 #include "FCInteractionProfile.h"
 #include "FCInteractionComponent.generated.h"
 
 class IIFCInteractable;
 class UUserWidget;
+class APawn;
+class AFCPlayerController;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogFCInteraction, Log, All);
 
@@ -37,6 +41,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void OnRegister() override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
@@ -73,12 +78,58 @@ public:
 	void OnPOIActionSelected(EFCPOIAction SelectedAction);
 
 protected:
-	/** Performs a line trace to detect interactables */
+	/** Runs the active profile's probe and updates the focused interactable */
 	void DetectInteractables();
 
-	/** Updates the interaction prompt widget */
+	// --- Probes (one per EFCProbeType); each returns the validated focus candidate or nullptr ---
+
+	/** One view-point trace: a line, or a sphere sweep when Radius > 0 */
+	struct FProbeTrace
+	{
+		FVector Start = FVector::ZeroVector;
+		FVector End = FVector::ZeroVector;
+		ECollisionChannel Channel = ECC_Visibility;
+		float Radius = 0.f;
+		FCollisionQueryParams Params;
+	};
+
+	/** Trace from the view point out to Range; sphere of Profile->Radius when bSphere */
+	FProbeTrace BuildProbeTrace(AFCPlayerController* PC, const UFCInteractionProfile* Profile, bool bSphere) const;
+
+	/** Synchronous LineTrace / SphereTrace probe (profile bSynchronousTrace) */
+	AActor* ProbeTrace(AFCPlayerController* PC, const UFCInteractionProfile* Profile, bool bSphere);
+
+	/** Debug draw plus candidate validation of a finished trace; Hit is null on a miss */
+	AActor* ResolveTraceHit(const FProbeTrace& Trace, const FHitResult* Hit, const UFCInteractionProfile* Profile);
+
+	/** Actor under the mouse cursor, within Range of the possessed pawn */
+	AActor* ProbeCursor(AFCPlayerController* PC, const UFCInteractionProfile* Profile);
+
+	/**
+	 * Best candidate within Range of the possessed pawn from the pawn's overlap set and the
+	 * overworld POI registry (highest interaction priority, then nearest). Issues no physics queries.
+	 */
+	AActor* ProbeOverlaps(AFCPlayerController* PC, const UFCInteractionProfile* Profile);
+
+	/**
+	 * Tag filter, then either IFCInteractable (per-object range at Distance from the interactor, CanInteract)
+	 * or IFCInteractablePOI (no further checks; actions are resolved on Interact)
+	 */
+	bool IsValidFocusCandidate(AActor* Candidate, float Distance, const UFCInteractionProfile* Profile) const;
+
+	/** Prompt text of a valid focus candidate: interaction prompt, or the POI name */
+	FText GetFocusPrompt(AActor* FocusActor) const;
+
+	void SetFocusedInteractable(AActor* NewFocus);
+
+	/** Pushes prompt text / visibility when focus changed since the last call; no-op while focus is stable */
 	void UpdatePromptWidget();
 
+	/** Screen placement for prompt widgets not derived from UFCInteractionPromptWidget */
+	void UpdateLegacyPromptPosition(const AActor* FocusActor);
+
+	void HidePromptWidget();
+
 protected:
 	/** Maximum distance for interaction line trace */
 	UPROPERTY(EditDefaultsOnly, Category = "Interaction")
@@ -88,7 +139,7 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "Interaction")
 	float InteractionCheckFrequency = 0.1f;
 
-	/** Widget class for the interaction prompt (e.g., "Press E to Open Door") */
+	/** Widget class for the interaction prompt (e.g., "Press E to Open Door"); should derive from UFCInteractionPromptWidget */
 	UPROPERTY(EditDefaultsOnly, Category = "Interaction|UI")
 	TSubclassOf<UUserWidget> InteractionPromptWidgetClass;
 
@@ -141,6 +192,14 @@ private:
 	UPROPERTY()
 	TObjectPtr<UUserWidget> InteractionPromptWidget;
 
+	/** Actor whose prompt text the widget currently shows (focus-change detection) */
+	TWeakObjectPtr<AActor> PromptActor;
+
+	bool bPromptShown = false;
+
+	/** SetInteractionPrompt of a legacy (non UFCInteractionPromptWidget) prompt, resolved once in BeginPlay */
+	UFunction* LegacySetPromptFunction = nullptr;
+
 	/** Timer for interaction checks */
 	float InteractionCheckTimer = 0.0f;
 
@@ -153,8 +212,48 @@ private:
 	/** Returns cached owner PC, logs once if missing */
 	AFCPlayerController* GetOwnerPCCheckedOrNull() const;
 
-    /** Whether FirstPerson focus tracing / prompts are currently enabled. */
-    bool bFirstPersonFocusEnabled = false;
+	// --- Async LineTrace / SphereTrace ---
+	// Traces go into the world's async trace batch (shared by every component that probes this
+	// frame) and are read back on the next tick through a small ring of handles.
+
+	struct FPendingProbe
+	{
+		FTraceHandle Handle;
+		FProbeTrace Trace;
+		TWeakObjectPtr<const UFCInteractionProfile> Profile;
+	};
+
+	static constexpr int32 MaxPendingProbes = 4;
+	FPendingProbe PendingProbes[MaxPendingProbes];
+	int32 PendingProbeHead = 0;
+	int32 NumPendingProbes = 0;
+
+	void SubmitAsyncProbe(AFCPlayerController* PC, const UFCInteractionProfile* Profile, bool bSphere);
+
+	/** Applies the newest finished trace to the focus; returns true if focus was re-evaluated */
+	bool ConsumeAsyncProbes();
+
+	/** Drops in-flight traces (focus cleared, profile changed) */
+	void ResetAsyncProbes();
+
+	// --- OverlapOnly: persistent overlap set of the possessed pawn ---
+
+	/** Pawn whose actor overlap events feed OverlapCandidates; rebound when possession changes */
+	TWeakObjectPtr<APawn> OverlapPawn;
+
+	TSet<TWeakObjectPtr<AActor>> OverlapCandidates;
+
+	/** Moves the overlap bindings to Pawn (nullptr unbinds) and seeds the set from its current overlaps */
+	void BindOverlapPawn(APawn* Pawn);
+
+	UFUNCTION()
+	void HandleOverlapPawnBeginOverlap(AActor* OverlappedActor, AActor* OtherActor);
+
+	UFUNCTION()
+	void HandleOverlapPawnEndOverlap(AActor* OverlappedActor, AActor* OtherActor);
+
+    /** Whether focus probing / prompts are currently enabled (set per player mode). */
+    bool bFocusEnabled = false;
 
     /** Clears current focus target and hides the prompt widget, if any. */
     void ClearFocusAndHidePrompt();
@@ -167,7 +266,14 @@ public:
 		return bAwaitingSelection || bAwaitingArrival;
 	}
 
-	void SetFirstPersonFocusEnabled(bool bEnabled);
+	/** Enables focus probing with the active profile's probe type; disabling clears focus and the prompt */
+	void SetFocusEnabled(bool bEnabled);
 
 	void ApplyInteractionProfile(UFCInteractionProfile* NewProfile);
+
+	/** Profile set by ApplyInteractionProfile; nullptr when DefaultProfile (or the legacy line trace) is used */
+	UFCInteractionProfile* GetActiveProfile() const { return ActiveProfile; }
+
+	/** Runs one check now, outside the check timer, and returns the focus; async trace profiles only submit here */
+	AActor* DetectInteractablesNow();
 };
@@ -8,9 +8,13 @@
 UENUM(BlueprintType)
 enum class EFCProbeType : uint8
 {
+    /** Line trace from the view point along the view direction */
     LineTrace,
+    /** Sphere sweep of Radius from the view point; forgiving aim */
     SphereTrace,
+    /** Actor under the mouse cursor, within Range of the pawn (top-down views) */
     CursorHit,
+    /** Pawn overlaps plus registered overworld POIs within Range; no physics queries */
     OverlapOnly
 };
 
@@ -20,6 +24,10 @@ class FC_API UFCInteractionProfile : public UDataAsset
     GENERATED_BODY()
 
 public:
+    /** Run focus probes and prompts in modes using this profile */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Probe")
+    bool bDetectFocus = true;
+
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Probe")
     EFCProbeType ProbeType = EFCProbeType::LineTrace;
 
@@ -32,6 +40,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Probe")
     float Radius = 50.f;
 
+    /** Trace on the game thread and apply the hit immediately instead of reading an async trace next frame (deterministic tests) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Probe")
+    bool bSynchronousTrace = false;
+
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="UI")
     TSubclassOf<UUserWidget> PromptWidgetClass;
 
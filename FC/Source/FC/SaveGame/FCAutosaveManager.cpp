@@ -0,0 +1,234 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#include "SaveGame/FCAutosaveManager.h"
+
+#include "Core/UFCGameInstance.h"
+#include "SaveGame/FCSaveManager.h"
+#include "TimerManager.h"
+
+namespace FCAutosaveRing
+{
+	const TCHAR* SlotPrefix = TEXT("AutoSave_");
+}
+
+void UFCAutosaveManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	UFCSaveManager* SaveManager = Collection.InitializeDependency<UFCSaveManager>();
+	UFCGameStateManager* StateMgr = Collection.InitializeDependency<UFCGameStateManager>();
+
+	if (StateMgr)
+	{
+		StateMgr->OnStateChanged.AddDynamic(this, &UFCAutosaveManager::OnGameStateChanged);
+	}
+
+	// Continue the ring after the newest autosave so the oldest entry is overwritten first.
+	RingSize = FMath::Max(1, RingSize);
+	NextRingIndex = 0;
+	const FString Latest = GetLatestAutosaveSlot();
+	if (!Latest.IsEmpty())
+	{
+		const int32 LatestNumber = FCString::Atoi(*Latest.RightChop(FCString::Strlen(FCAutosaveRing::SlotPrefix)));
+		if (LatestNumber >= 1 && LatestNumber <= RingSize)
+		{
+			NextRingIndex = LatestNumber % RingSize;
+		}
+	}
+
+	RestartTimer();
+
+	UE_LOG(LogFCSave, Log, TEXT("UFCAutosaveManager initialized (ring of %d, every %.0f s, next slot %s)%s"),
+		RingSize, IntervalSeconds, *MakeRingSlotName(NextRingIndex), SaveManager ? TEXT("") : TEXT(" - no SaveManager"));
+}
+
+void UFCAutosaveManager::Deinitialize()
+{
+	if (UGameInstance* GI = GetGameInstance())
+	{
+		GI->GetTimerManager().ClearTimer(AutosaveTimerHandle);
+		GI->GetTimerManager().ClearTimer(ProgressAutosaveTimerHandle);
+
+		if (UFCGameStateManager* StateMgr = GI->GetSubsystem<UFCGameStateManager>())
+		{
+			StateMgr->OnStateChanged.RemoveDynamic(this, &UFCAutosaveManager::OnGameStateChanged);
+		}
+	}
+
+	Super::Deinitialize();
+}
+
+bool UFCAutosaveManager::RequestAutosave()
+{
+	UFCGameInstance* GI = Cast<UFCGameInstance>(GetGameInstance());
+	UFCGameStateManager* StateMgr = GI ? GI->GetSubsystem<UFCGameStateManager>() : nullptr;
+	if (!GI || !StateMgr || bAutosaveInFlight || GI->IsRestoringSaveGame()
+		|| !CanAutosaveInState(StateMgr->GetCurrentState()))
+	{
+		return false;
+	}
+
+	const FString SlotName = MakeRingSlotName(NextRingIndex);
+	UE_LOG(LogFCSave, Log, TEXT("Autosave: Writing %s"), *SlotName);
+
+	bAutosaveInFlight = GI->SaveGame(SlotName, FFCOnSaveWriteComplete::CreateWeakLambda(this,
+		[this](const FString& SavedSlotName, bool bSuccess)
+		{
+			bAutosaveInFlight = false;
+			if (!bSuccess)
+			{
+				UE_LOG(LogFCSave, Warning, TEXT("Autosave: Writing %s failed; the other ring entries are untouched"), *SavedSlotName);
+			}
+		}));
+
+	if (!bAutosaveInFlight)
+	{
+		return false;
+	}
+
+	NextRingIndex = (NextRingIndex + 1) % RingSize;
+	LastAutosaveTime = FPlatformTime::Seconds();
+	RestartTimer();
+
+	// This write already carries any pending progress.
+	GI->GetTimerManager().ClearTimer(ProgressAutosaveTimerHandle);
+	return true;
+}
+
+void UFCAutosaveManager::RequestProgressAutosave()
+{
+	FTimerManager& TimerManager = GetGameInstance()->GetTimerManager();
+	if (TimerManager.IsTimerActive(ProgressAutosaveTimerHandle))
+	{
+		return;
+	}
+
+	const double SinceLast = LastAutosaveTime > 0.0 ? FPlatformTime::Seconds() - LastAutosaveTime : MinSecondsBetweenAutosaves;
+	const float Delay = FMath::Max(0.f, MinSecondsBetweenAutosaves - static_cast<float>(SinceLast));
+	if (Delay > 0.f)
+	{
+		TimerManager.SetTimer(ProgressAutosaveTimerHandle, this, &UFCAutosaveManager::OnProgressAutosaveTimer, Delay, false);
+	}
+	else
+	{
+		ProgressAutosaveTimerHandle = TimerManager.SetTimerForNextTick(this, &UFCAutosaveManager::OnProgressAutosaveTimer);
+	}
+}
+
+FString UFCAutosaveManager::GetLatestAutosaveSlot() const
+{
+	if (const UFCSaveManager* SaveManager = GetGameInstance()->GetSubsystem<UFCSaveManager>())
+	{
+		// The index is sorted newest first
+		for (const FFCSaveSlotInfo& Info : SaveManager->GetSlotInfos())
+		{
+			if (IsAutosaveSlot(Info.SlotName))
+			{
+				return Info.SlotName;
+			}
+		}
+	}
+	return FString();
+}
+
+FString UFCAutosaveManager::GetFallbackSlot(const FString& FailedSlot) const
+{
+	const UFCSaveManager* SaveManager = GetGameInstance()->GetSubsystem<UFCSaveManager>();
+	if (!SaveManager || !IsAutosaveSlot(FailedSlot))
+	{
+		return FString();
+	}
+
+	const TArray<FFCSaveSlotInfo>& Infos = SaveManager->GetSlotInfos();
+	int32 Start = 0;
+	for (int32 Index = 0; Index < Infos.Num(); ++Index)
+	{
+		if (Infos[Index].SlotName == FailedSlot)
+		{
+			Start = Index + 1;
+			break;
+		}
+	}
+
+	for (int32 Index = Start; Index < Infos.Num(); ++Index)
+	{
+		if (IsAutosaveSlot(Infos[Index].SlotName) && Infos[Index].SlotName != FailedSlot)
+		{
+			return Infos[Index].SlotName;
+		}
+	}
+	return FString();
+}
+
+bool UFCAutosaveManager::IsAutosaveSlot(const FString& SlotName)
+{
+	return SlotName.StartsWith(FCAutosaveRing::SlotPrefix);
+}
+
+void UFCAutosaveManager::OnGameStateChanged(EFCGameStateID OldState, EFCGameStateID NewState)
+{
+	// Arrivals only: transitions run through Loading, so Overworld_Travel -> Camp_Local shows up
+	// as Loading -> Camp_Local. Resuming from pause is not an arrival.
+	if ((NewState != EFCGameStateID::Camp_Local && NewState != EFCGameStateID::Overworld_Travel)
+		|| OldState == EFCGameStateID::Paused)
+	{
+		return;
+	}
+
+	if (LastAutosaveTime > 0.0 && FPlatformTime::Seconds() - LastAutosaveTime < MinSecondsBetweenAutosaves)
+	{
+		return;
+	}
+
+	// The state flips while the level is still setting up; save once the pawn is in place.
+	GetGameInstance()->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(this, [this]()
+	{
+		RequestAutosave();
+	}));
+}
+
+void UFCAutosaveManager::OnAutosaveTimer()
+{
+	if (!RequestAutosave())
+	{
+		UE_LOG(LogFCSave, Verbose, TEXT("Autosave: Timer skipped (state not saveable or a write is in flight)"));
+	}
+}
+
+void UFCAutosaveManager::OnProgressAutosaveTimer()
+{
+	ProgressAutosaveTimerHandle.Invalidate();
+	if (RequestAutosave())
+	{
+		return;
+	}
+
+	// Retry once the write in flight has landed; in an unsaveable state the progress waits for the next autosave.
+	if (bAutosaveInFlight)
+	{
+		GetGameInstance()->GetTimerManager().SetTimer(ProgressAutosaveTimerHandle, this,
+			&UFCAutosaveManager::OnProgressAutosaveTimer, FMath::Max(1.f, MinSecondsBetweenAutosaves), false);
+	}
+}
+
+void UFCAutosaveManager::RestartTimer()
+{
+	FTimerManager& TimerManager = GetGameInstance()->GetTimerManager();
+	TimerManager.ClearTimer(AutosaveTimerHandle);
+	if (IntervalSeconds > 0.f)
+	{
+		TimerManager.SetTimer(AutosaveTimerHandle, this, &UFCAutosaveManager::OnAutosaveTimer, IntervalSeconds, true);
+	}
+}
+
+bool UFCAutosaveManager::CanAutosaveInState(EFCGameStateID State) const
+{
+	return State == EFCGameStateID::Office_Exploration
+		|| State == EFCGameStateID::Overworld_Travel
+		|| State == EFCGameStateID::Camp_Local;
+}
+
+FString UFCAutosaveManager::MakeRingSlotName(int32 RingIndex)
+{
+	return FString::Printf(TEXT("%s%03d"), FCAutosaveRing::SlotPrefix, RingIndex + 1);
+}
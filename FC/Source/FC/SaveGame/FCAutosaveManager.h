@@ -0,0 +1,85 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Core/FCGameStateManager.h"
+#include "FCAutosaveManager.generated.h"
+
+/**
+ * UFCAutosaveManager
+ *
+ * Game Instance subsystem that rotates autosaves through a fixed ring of slots
+ * (AutoSave_001..AutoSave_<RingSize>), so disk usage stays bounded.
+ * - Writes on a repeating timer, when arriving in Camp_Local / Overworld_Travel and after
+ *   gameplay progress (RequestProgressAutosave, e.g. each reveal brush stroke).
+ * - Always overwrites the oldest ring entry; the other entries stay valid while it is written.
+ * - GetFallbackSlot gives loads the next older ring entry when a slot fails its checksum.
+ *
+ * Crash safety of the individual writes (temp file + replace, payload CRC) is UFCSaveManager's.
+ * Settings live in [/Script/FC.FCAutosaveManager] in DefaultGame.ini.
+ */
+UCLASS(Config = Game)
+class FC_API UFCAutosaveManager : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Write the next ring slot now, unless the game is in a state that cannot be saved or an autosave is in flight. */
+	UFUNCTION(BlueprintCallable, Category = "SaveGame|Autosave")
+	bool RequestAutosave();
+
+	/**
+	 * Something worth keeping changed (e.g. newly revealed world map cells). Schedules one autosave
+	 * MinSecondsBetweenAutosaves after the previous one; repeated calls before it runs are merged.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SaveGame|Autosave")
+	void RequestProgressAutosave();
+
+	/** Newest autosave slot in the save index, empty if there is none */
+	UFUNCTION(BlueprintPure, Category = "SaveGame|Autosave")
+	FString GetLatestAutosaveSlot() const;
+
+	/** Next older ring entry after the autosave FailedSlot; empty when the ring is exhausted or FailedSlot is not an autosave. */
+	FString GetFallbackSlot(const FString& FailedSlot) const;
+
+	static bool IsAutosaveSlot(const FString& SlotName);
+
+	/** Number of ring slots */
+	UPROPERTY(Config, EditAnywhere, Category = "Autosave", meta = (ClampMin = "1"))
+	int32 RingSize = 3;
+
+	/** Seconds between timed autosaves; 0 disables the timer */
+	UPROPERTY(Config, EditAnywhere, Category = "Autosave")
+	float IntervalSeconds = 300.f;
+
+	/** Transition autosaves closer than this to the previous autosave are skipped; progress autosaves wait for it */
+	UPROPERTY(Config, EditAnywhere, Category = "Autosave")
+	float MinSecondsBetweenAutosaves = 30.f;
+
+private:
+	UFUNCTION()
+	void OnGameStateChanged(EFCGameStateID OldState, EFCGameStateID NewState);
+
+	void OnAutosaveTimer();
+	void OnProgressAutosaveTimer();
+	void RestartTimer();
+
+	bool CanAutosaveInState(EFCGameStateID State) const;
+	static FString MakeRingSlotName(int32 RingIndex);
+
+	/** 0-based ring position written next */
+	int32 NextRingIndex = 0;
+
+	bool bAutosaveInFlight = false;
+
+	/** FPlatformTime::Seconds() of the last autosave request, 0 if none yet */
+	double LastAutosaveTime = 0.0;
+
+	FTimerHandle AutosaveTimerHandle;
+	FTimerHandle ProgressAutosaveTimerHandle;
+};
@@ -0,0 +1,128 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#include "SaveGame/FCCampaignSnapshot.h"
+
+#include "SaveGame/FCSaveManager.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+void FFCCampaignSnapshot::AddSection(uint32 SectionId, uint16 Version, TFunctionRef<void(FArchive&)> Writer)
+{
+	check(!FindSection(SectionId));
+
+	FSection& Section = Sections.AddDefaulted_GetRef();
+	Section.Id = SectionId;
+	Section.Version = Version;
+	Section.Offset = Data.Num();
+
+	// Appends after the previous payloads
+	FMemoryWriter Ar(Data, false, true);
+	Writer(Ar);
+	Section.Size = Data.Num() - Section.Offset;
+}
+
+void FFCCampaignSnapshot::Serialize(TArray<uint8>& OutBytes) const
+{
+	OutBytes.Reset();
+	FMemoryWriter Ar(OutBytes);
+
+	uint32 FileMagic = Magic;
+	uint16 FileVersion = FormatVersion;
+	int32 NumSections = Sections.Num();
+	Ar << FileMagic;
+	Ar << FileVersion;
+	Ar << NumSections;
+
+	for (const FSection& Section : Sections)
+	{
+		uint32 Id = Section.Id;
+		uint16 Version = Section.Version;
+		int32 Size = Section.Size;
+		Ar << Id;
+		Ar << Version;
+		Ar << Size;
+	}
+
+	for (const FSection& Section : Sections)
+	{
+		Ar.Serialize(const_cast<uint8*>(Data.GetData() + Section.Offset), Section.Size);
+	}
+}
+
+bool FFCCampaignSnapshot::Parse(TArray<uint8>&& InBytes)
+{
+	Sections.Reset();
+	Data = MoveTemp(InBytes);
+
+	FMemoryReader Ar(Data);
+	uint32 FileMagic = 0;
+	uint16 FileVersion = 0;
+	int32 NumSections = 0;
+	Ar << FileMagic;
+	Ar << FileVersion;
+	Ar << NumSections;
+
+	if (Ar.IsError() || FileMagic != Magic || FileVersion > FormatVersion || NumSections < 0)
+	{
+		Data.Reset();
+		return false;
+	}
+
+	// The count comes from the file; a table that cannot fit in the remaining bytes is corrupt.
+	if (NumSections > (Data.Num() - Ar.Tell()) / SectionHeaderBytes)
+	{
+		UE_LOG(LogFCSave, Error, TEXT("FFCCampaignSnapshot: Section count %d does not fit in %d bytes"), NumSections, Data.Num());
+		Data.Reset();
+		return false;
+	}
+
+	Sections.Reserve(NumSections);
+	for (int32 Index = 0; Index < NumSections && !Ar.IsError(); ++Index)
+	{
+		FSection& Section = Sections.AddDefaulted_GetRef();
+		Ar << Section.Id;
+		Ar << Section.Version;
+		Ar << Section.Size;
+	}
+
+	// Payloads follow the table back to back
+	int64 Offset = Ar.Tell();
+	for (FSection& Section : Sections)
+	{
+		if (Ar.IsError() || Section.Size < 0 || Offset + Section.Size > Data.Num())
+		{
+			UE_LOG(LogFCSave, Error, TEXT("FFCCampaignSnapshot: Section table does not match the payload size"));
+			Sections.Reset();
+			Data.Reset();
+			return false;
+		}
+		Section.Offset = static_cast<int32>(Offset);
+		Offset += Section.Size;
+	}
+	return true;
+}
+
+bool FFCCampaignSnapshot::HasSection(uint32 SectionId) const
+{
+	return FindSection(SectionId) != nullptr;
+}
+
+bool FFCCampaignSnapshot::ReadSection(uint32 SectionId, TFunctionRef<void(FArchive& Ar, uint16 Version)> Reader) const
+{
+	const FSection* Section = FindSection(SectionId);
+	if (!Section)
+	{
+		return false;
+	}
+
+	// View the payload in place
+	const TArrayView<const uint8> Payload(Data.GetData() + Section->Offset, Section->Size);
+	FMemoryReaderView Ar(Payload);
+	Reader(Ar, Section->Version);
+	return !Ar.IsError();
+}
+
+const FFCCampaignSnapshot::FSection* FFCCampaignSnapshot::FindSection(uint32 SectionId) const
+{
+	return Sections.FindByPredicate([SectionId](const FSection& Section) { return Section.Id == SectionId; });
+}
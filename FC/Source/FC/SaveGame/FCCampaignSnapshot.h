@@ -0,0 +1,84 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+/** Four-character section id, first character in the low byte */
+constexpr uint32 FCMakeCampaignSectionId(char A, char B, char C, char D)
+{
+	return static_cast<uint32>(static_cast<uint8>(A))
+		| (static_cast<uint32>(static_cast<uint8>(B)) << 8)
+		| (static_cast<uint32>(static_cast<uint8>(C)) << 16)
+		| (static_cast<uint32>(static_cast<uint8>(D)) << 24);
+}
+
+namespace FCCampaignSection
+{
+	/** FFCGameStateData (UFCGameInstance) */
+	constexpr uint32 GameState = FCMakeCampaignSectionId('G', 'A', 'M', 'E');
+
+	/** Current UFCExpeditionData including the planned route (UFCExpeditionManager) */
+	constexpr uint32 Expedition = FCMakeCampaignSectionId('E', 'X', 'P', 'D');
+
+	/** Reveal and land masks (UFCExpeditionManager) */
+	constexpr uint32 WorldMap = FCMakeCampaignSectionId('W', 'M', 'A', 'P');
+}
+
+/**
+ * FFCCampaignSnapshot
+ *
+ * Chunked binary archive of the whole campaign, stored in UFCSaveGame::CampaignSnapshot
+ * so one save file holds every subsystem's state.
+ *
+ * Layout: [magic][format version][section count][section table: id, version, size][payloads]
+ *
+ * Each section carries its own version, so a subsystem can change its layout without touching
+ * the others; readers skip sections they do not know. Parsing only reads the table: payloads
+ * are deserialized when their owner first asks for them.
+ */
+class FC_API FFCCampaignSnapshot
+{
+public:
+	/** 'FCCS' little-endian */
+	static constexpr uint32 Magic = 0x53434346;
+	static constexpr uint16 FormatVersion = 1;
+
+	/** Append a section; Writer serializes the payload into the archive it is given. */
+	void AddSection(uint32 SectionId, uint16 Version, TFunctionRef<void(FArchive&)> Writer);
+
+	void Serialize(TArray<uint8>& OutBytes) const;
+
+	/** Take ownership of serialized bytes and index their sections; false if they are not a valid snapshot. */
+	bool Parse(TArray<uint8>&& InBytes);
+
+	bool HasSection(uint32 SectionId) const;
+
+	/**
+	 * Run Reader over the section's payload with the version it was written with.
+	 * False if the section is missing or the payload was shorter than Reader expected.
+	 */
+	bool ReadSection(uint32 SectionId, TFunctionRef<void(FArchive& Ar, uint16 Version)> Reader) const;
+
+	int32 Num() const { return Sections.Num(); }
+
+private:
+	/** Serialized size of one section table entry: id (uint32), version (uint16), size (int32) */
+	static constexpr int32 SectionHeaderBytes = sizeof(uint32) + sizeof(uint16) + sizeof(int32);
+
+	struct FSection
+	{
+		uint32 Id = 0;
+		uint16 Version = 0;
+		int32 Offset = 0;
+		int32 Size = 0;
+	};
+
+	const FSection* FindSection(uint32 SectionId) const;
+
+	TArray<FSection> Sections;
+
+	/** Concatenated payloads when writing; the whole snapshot when parsed */
+	TArray<uint8> Data;
+};
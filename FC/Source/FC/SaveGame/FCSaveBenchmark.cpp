@@ -0,0 +1,586 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Async/TaskGraphInterfaces.h"
+#include "Core/UFCGameInstance.h"
+#include "Expedition/FCExpeditionManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "PlatformFeatures.h"
+#include "SaveGame/FCCampaignSnapshot.h"
+#include "SaveGame/FCSaveGame.h"
+#include "SaveGame/FCSaveManager.h"
+#include "SaveGameSystem.h"
+#include "UObject/StrongObjectPtr.h"
+
+/**
+ * FC.Save.Benchmark
+ *
+ * Save/load regression test on synthetic campaigns. It needs no map, viewport or live game
+ * instance, so it runs headless:
+ *   UnrealEditor-Cmd FC.uproject -nullrhi -unattended -ExecCmds="Automation RunTests FC.Save; Quit"
+ *
+ * Every iteration is a new synthetic expedition (random-walk route of fc.SaveBenchmark.RouteLength
+ * cells). Slot payloads go through the production path of a UFCSaveManager: WriteSaveDataAsync
+ * (background encode + atomic temp-file write) flushed to disk, then LoadGameFromSlotAsync
+ * (background read, decode, deserialize) with its completion on the game thread. Snapshot
+ * sections are timed in memory. Everything is checked for a lossless round trip.
+ * Results go to Saved/Profiling/FCSaveBenchmark_<time>.csv; rows over the fc.SaveBenchmark.*
+ * budgets fail the test.
+ */
+namespace FCSaveBenchmark
+{
+	static TAutoConsoleVariable<int32> CVarIterations(
+		TEXT("fc.SaveBenchmark.Iterations"), 10,
+		TEXT("FC.Save.Benchmark: synthetic campaigns per case"));
+
+	static TAutoConsoleVariable<int32> CVarRouteLength(
+		TEXT("fc.SaveBenchmark.RouteLength"), 4000,
+		TEXT("FC.Save.Benchmark: planned route cells of each synthetic expedition"));
+
+	static TAutoConsoleVariable<float> CVarSaveBudgetMs(
+		TEXT("fc.SaveBenchmark.SaveBudgetMs"), 16.f,
+		TEXT("FC.Save.Benchmark: max serialize + compress + write time (ms) of any payload"));
+
+	static TAutoConsoleVariable<float> CVarLoadBudgetMs(
+		TEXT("fc.SaveBenchmark.LoadBudgetMs"), 16.f,
+		TEXT("FC.Save.Benchmark: max read + decompress + deserialize + restore time (ms) of any payload"));
+
+	static TAutoConsoleVariable<int32> CVarFileBudgetKB(
+		TEXT("fc.SaveBenchmark.FileBudgetKB"), 256,
+		TEXT("FC.Save.Benchmark: max file size (KB) of any payload"));
+
+	const TCHAR* SlotName = TEXT("FC_SaveBenchmark");
+	constexpr int32 UserIndex = 0;
+
+	/** Give up on a background write or load after this long (counts as a failed round trip) */
+	constexpr double IoTimeoutSeconds = 10.0;
+
+	enum EPhase : int32
+	{
+		/** Game thread: object or section to bytes */
+		Serialize,
+		/** WriteSaveDataAsync until the slot is on disk and its completion ran (encode + atomic write) */
+		Write,
+		/** LoadGameFromSlotAsync, split with FFCSaveLoadTimings */
+		Read,
+		Decompress,
+		Deserialize,
+		/** Game thread: sections back into live objects */
+		Restore,
+		NumPhases
+	};
+
+	/** One payload (section or slot) of one case, over all iterations */
+	struct FRow
+	{
+		FString Case;
+		FString Payload;
+		TArray<double> PhaseMs[NumPhases];
+		TArray<double> SaveMs;
+		TArray<double> LoadMs;
+		int32 RawBytes = 0;
+		int32 FileBytes = 0;
+		bool bRoundTripOk = true;
+	};
+
+	/** Synthetic campaign: masks plus one expedition */
+	struct FCampaign
+	{
+		FFCWorldMapBitMask Reveal;
+		FFCWorldMapBitMask Land;
+		uint32 AssetLandMaskHash = 0;
+		FFCGameStateData GameState;
+	};
+
+	double Median(TArray<double> Values)
+	{
+		if (Values.Num() == 0)
+		{
+			return 0.0;
+		}
+		Values.Sort();
+		return Values[Values.Num() / 2];
+	}
+
+	double Max(const TArray<double>& Values)
+	{
+		double Result = 0.0;
+		for (const double Value : Values)
+		{
+			Result = FMath::Max(Result, Value);
+		}
+		return Result;
+	}
+
+	void MakeCampaign(bool bFullyRevealed, FRandomStream& Random, FCampaign& Out)
+	{
+		constexpr int32 GlobalSize = FFCWorldMapExploration::GlobalSize;
+		constexpr int32 GridSize = FFCWorldMapExploration::GridSize;
+		constexpr int32 SubSize = FFCWorldMapExploration::SubSize;
+
+		Out.Reveal.Init(GlobalSize, GlobalSize, bFullyRevealed);
+		Out.Land.Init(GlobalSize, GlobalSize, true);
+
+		if (bFullyRevealed)
+		{
+			// Worst case: scattered water cells force the land mask into the save.
+			for (int32 Index = 0; Index < Out.Land.Num(); ++Index)
+			{
+				if (Random.FRand() < 0.2f)
+				{
+					Out.Land.Set(Index, false);
+				}
+			}
+			Out.AssetLandMaskHash = 0;
+		}
+		else
+		{
+			// About 40% of the areas with ragged edges; the land mask matches the asset.
+			for (int32 GridId = 0; GridId < GridSize * GridSize; ++GridId)
+			{
+				if (Random.FRand() >= 0.4f)
+				{
+					continue;
+				}
+				int32 AreaX, AreaY;
+				FFCWorldMapExploration::GridIdToXY(GridId, AreaX, AreaY);
+				for (int32 Y = 0; Y < SubSize; ++Y)
+				{
+					const int32 Width = Random.RandRange(SubSize / 2, SubSize);
+					for (int32 X = 0; X < Width; ++X)
+					{
+						Out.Reveal.Set(FFCWorldMapExploration::XYToGlobalId(AreaX * SubSize + X, AreaY * SubSize + Y), true);
+					}
+				}
+			}
+			Out.AssetLandMaskHash = Out.Land.GetHash();
+		}
+
+		Out.GameState.Supplies = Random.RandRange(0, 500);
+		Out.GameState.Money = Random.RandRange(0, 100000);
+		Out.GameState.Day = Random.RandRange(1, 1000);
+	}
+
+	UFCExpeditionData* MakeExpedition(int32 RouteLength, FRandomStream& Random)
+	{
+		UFCExpeditionData* Expedition = NewObject<UFCExpeditionData>();
+		Expedition->ExpeditionName = FString::Printf(TEXT("Benchmark Expedition %d"), Random.RandHelper(100000));
+		Expedition->StartDate = TEXT("Day 1");
+		Expedition->TargetRegion = TEXT("Synthetic Region");
+		Expedition->StartingSupplies = Random.RandRange(10, 200);
+		Expedition->ExpeditionStatus = EFCExpeditionStatus::Planning;
+		Expedition->SelectedGridId = Random.RandRange(0, 255);
+		Expedition->SelectedStartGridId = Expedition->SelectedGridId;
+		Expedition->SelectedStartSubId = Random.RandRange(0, 255);
+		Expedition->PreviewTargetGridId = Random.RandRange(0, 255);
+		Expedition->PreviewTargetSubId = Random.RandRange(0, 255);
+		Expedition->PlannedMoneyCost = Random.RandRange(0, 10000);
+		Expedition->PlannedRiskCost = Random.RandRange(0, 1000);
+
+		// 4-neighbour random walk
+		constexpr int32 GlobalSize = FFCWorldMapExploration::GlobalSize;
+		int32 X = Random.RandRange(0, GlobalSize - 1);
+		int32 Y = Random.RandRange(0, GlobalSize - 1);
+		Expedition->PlannedRouteGlobalIds.Reserve(RouteLength);
+		for (int32 Step = 0; Step < RouteLength; ++Step)
+		{
+			Expedition->PlannedRouteGlobalIds.Add(FFCWorldMapExploration::XYToGlobalId(X, Y));
+			const int32 Dir = Random.RandHelper(4);
+			X = FMath::Clamp(X + (Dir == 0 ? 1 : Dir == 1 ? -1 : 0), 0, GlobalSize - 1);
+			Y = FMath::Clamp(Y + (Dir == 2 ? 1 : Dir == 3 ? -1 : 0), 0, GlobalSize - 1);
+		}
+		return Expedition;
+	}
+
+	void AddSample(FRow& Row, const double (&Phase)[NumPhases], int32 RawBytes, int32 FileBytes, bool bOk)
+	{
+		for (int32 Index = 0; Index < NumPhases; ++Index)
+		{
+			Row.PhaseMs[Index].Add(Phase[Index]);
+		}
+		Row.SaveMs.Add(Phase[Serialize] + Phase[Write]);
+		Row.LoadMs.Add(Phase[Read] + Phase[Decompress] + Phase[Deserialize] + Phase[Restore]);
+		Row.RawBytes = FMath::Max(Row.RawBytes, RawBytes);
+		Row.FileBytes = FMath::Max(Row.FileBytes, FileBytes);
+		Row.bRoundTripOk &= bOk;
+	}
+
+	/** Run game-thread tasks until bDone; save manager completions arrive through AsyncTask(GameThread) */
+	bool PumpGameThreadUntil(const bool& bDone)
+	{
+		const double Deadline = FPlatformTime::Seconds() + IoTimeoutSeconds;
+		while (!bDone && FPlatformTime::Seconds() < Deadline)
+		{
+			FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+			FPlatformProcess::SleepNoStats(0.f);
+		}
+		return bDone;
+	}
+
+	/** Write a USaveGame payload and read it back through SaveManager, like UFCGameInstance::SaveGame / LoadGameAsync */
+	void MeasureSlot(UFCSaveManager& SaveManager, FRow& Row, TFunctionRef<USaveGame*()> Produce, TFunctionRef<bool(USaveGame*)> RestorePayload)
+	{
+		double Phase[NumPhases] = {};
+		double Start = FPlatformTime::Seconds();
+		auto Lap = [&Start](double& OutMs)
+		{
+			const double Now = FPlatformTime::Seconds();
+			OutMs = (Now - Start) * 1000.0;
+			Start = Now;
+		};
+
+		TArray<uint8> SaveData;
+		bool bOk = UGameplayStatics::SaveGameToMemory(Produce(), SaveData);
+		const int32 RawBytes = SaveData.Num();
+		Lap(Phase[Serialize]);
+
+		bool bWritten = false;
+		SaveManager.WriteSaveDataAsync(MoveTemp(SaveData), SlotName, UserIndex,
+			FFCOnSaveWriteComplete::CreateLambda([&bWritten](const FString&, bool bSuccess) { bWritten = bSuccess; }));
+		SaveManager.FlushPendingWrites();
+		bOk &= bWritten;
+		Lap(Phase[Write]);
+
+		bool bLoaded = false;
+		USaveGame* Loaded = nullptr;
+		FFCSaveLoadTimings Timings;
+		SaveManager.LoadGameFromSlotAsync(SlotName, UserIndex,
+			FFCOnSaveLoadComplete::CreateLambda([&bLoaded, &Loaded, &Timings](USaveGame* InLoaded, const FFCSaveLoadTimings& InTimings)
+			{
+				Loaded = InLoaded;
+				Timings = InTimings;
+				bLoaded = true;
+			}));
+		bOk &= PumpGameThreadUntil(bLoaded) && Loaded;
+		Phase[Read] = Timings.ReadMs;
+		Phase[Decompress] = Timings.DecompressMs;
+		Phase[Deserialize] = Timings.DeserializeMs;
+
+		Start = FPlatformTime::Seconds();
+		bOk = bOk && RestorePayload(Loaded);
+		Lap(Phase[Restore]);
+
+		AddSample(Row, Phase, RawBytes, Timings.FileBytes, bOk);
+	}
+
+	/** Encode and decode one snapshot section in memory (no file of its own; it ships inside CampaignSave) */
+	void MeasureSection(FRow& Row, TFunctionRef<void(FFCCampaignSnapshot&)> WriteSection, TFunctionRef<bool(const FFCCampaignSnapshot&)> ReadSection)
+	{
+		double Phase[NumPhases] = {};
+
+		double Start = FPlatformTime::Seconds();
+		TArray<uint8> Bytes;
+		{
+			FFCCampaignSnapshot Snapshot;
+			WriteSection(Snapshot);
+			Snapshot.Serialize(Bytes);
+		}
+		Phase[Serialize] = (FPlatformTime::Seconds() - Start) * 1000.0;
+		const int32 NumBytes = Bytes.Num();
+
+		Start = FPlatformTime::Seconds();
+		FFCCampaignSnapshot Snapshot;
+		const bool bOk = Snapshot.Parse(MoveTemp(Bytes)) && ReadSection(Snapshot);
+		Phase[Restore] = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		AddSample(Row, Phase, NumBytes, NumBytes, bOk);
+	}
+
+	/** Benchmark-only section id for the version 0 world map layout (two byte-per-cell masks) */
+	constexpr uint32 LegacyWorldMapSectionId = FCMakeCampaignSectionId('W', 'M', 'V', '0');
+
+	const FRow* FindRow(const TArray<FRow>& Rows, const FString& Case, const TCHAR* Payload)
+	{
+		return Rows.FindByPredicate([&Case, Payload](const FRow& Row) { return Row.Case == Case && Row.Payload == Payload; });
+	}
+
+	bool SameExpedition(const UFCExpeditionData* A, const UFCExpeditionData* B)
+	{
+		return A && B
+			&& A->ExpeditionName == B->ExpeditionName
+			&& A->ExpeditionStatus == B->ExpeditionStatus
+			&& A->PlannedRouteGlobalIds == B->PlannedRouteGlobalIds
+			&& A->PlannedMoneyCost == B->PlannedMoneyCost
+			&& A->PlannedRiskCost == B->PlannedRiskCost;
+	}
+
+	void RunCase(UFCSaveManager& SaveManager, const FString& CaseName, bool bFullyRevealed, int32 Iterations, int32 RouteLength, TArray<FRow>& OutRows)
+	{
+		const TCHAR* Payloads[] = { TEXT("Section.GAME"), TEXT("Section.EXPD"), TEXT("Section.WMAP"),
+			TEXT("CampaignSave"), TEXT("WorldMapV0") };
+		const int32 FirstRow = OutRows.Num();
+		for (const TCHAR* Payload : Payloads)
+		{
+			FRow& Row = OutRows.AddDefaulted_GetRef();
+			Row.Case = CaseName;
+			Row.Payload = Payload;
+		}
+
+		constexpr int32 GlobalSize = FFCWorldMapExploration::GlobalSize;
+
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			FRandomStream Random(1000 * (bFullyRevealed ? 2 : 1) + Iteration);
+			FCampaign Campaign;
+			MakeCampaign(bFullyRevealed, Random, Campaign);
+			UFCExpeditionData* Expedition = MakeExpedition(RouteLength, Random);
+
+			auto ReadGameState = [&Campaign](const FFCCampaignSnapshot& S)
+			{
+				FFCGameStateData Data;
+				return UFCGameInstance::ReadGameStateSection(S, Data)
+					&& Data.Money == Campaign.GameState.Money && Data.Day == Campaign.GameState.Day;
+			};
+			auto ReadExpedition = [Expedition](const FFCCampaignSnapshot& S)
+			{
+				UFCExpeditionData* Loaded = nullptr;
+				return UFCExpeditionManager::ReadExpeditionSection(S, GetTransientPackage(), Loaded)
+					&& SameExpedition(Expedition, Loaded);
+			};
+			auto ReadWorldMap = [&Campaign](const FFCCampaignSnapshot& S)
+			{
+				FFCWorldMapBitMask Reveal(GlobalSize, GlobalSize);
+				FFCWorldMapBitMask Land(GlobalSize, GlobalSize);
+				bool bHasLand = false;
+				return UFCExpeditionManager::ReadWorldMapSection(S, Reveal, Land, bHasLand)
+					&& Reveal == Campaign.Reveal && (!bHasLand || Land == Campaign.Land);
+			};
+
+			// --- Snapshot sections ------------------------------------------------
+			MeasureSection(OutRows[FirstRow + 0],
+				[&](FFCCampaignSnapshot& S) { UFCGameInstance::WriteGameStateSection(S, Campaign.GameState); },
+				ReadGameState);
+
+			MeasureSection(OutRows[FirstRow + 1],
+				[&](FFCCampaignSnapshot& S) { UFCExpeditionManager::WriteExpeditionSection(S, Expedition); },
+				ReadExpedition);
+
+			MeasureSection(OutRows[FirstRow + 2],
+				[&](FFCCampaignSnapshot& S) { UFCExpeditionManager::WriteWorldMapSection(S, Campaign.Reveal, Campaign.Land, Campaign.AssetLandMaskHash); },
+				ReadWorldMap);
+
+			// --- Whole campaign save (what UFCGameInstance::SaveGame writes) ------
+			MeasureSlot(SaveManager, OutRows[FirstRow + 3],
+				[&]() -> USaveGame*
+				{
+					UFCSaveGame* Save = NewObject<UFCSaveGame>();
+					Save->SaveSlotName = SlotName;
+					Save->Timestamp = FDateTime::Now();
+					FFCCampaignSnapshot S;
+					UFCGameInstance::WriteGameStateSection(S, Campaign.GameState);
+					UFCExpeditionManager::WriteExpeditionSection(S, Expedition);
+					UFCExpeditionManager::WriteWorldMapSection(S, Campaign.Reveal, Campaign.Land, Campaign.AssetLandMaskHash);
+					S.Serialize(Save->CampaignSnapshot);
+					return Save;
+				},
+				[&](USaveGame* Loaded)
+				{
+					UFCSaveGame* Save = Cast<UFCSaveGame>(Loaded);
+					FFCCampaignSnapshot S;
+					return Save && S.Parse(MoveTemp(Save->CampaignSnapshot))
+						&& ReadGameState(S) && ReadExpedition(S) && ReadWorldMap(S);
+				});
+
+			// --- Version 0 layout (one byte per cell), the baseline of the WMAP section
+			MeasureSection(OutRows[FirstRow + 4],
+				[&](FFCCampaignSnapshot& S)
+				{
+					S.AddSection(LegacyWorldMapSectionId, 0, [&Campaign](FArchive& Ar)
+					{
+						TArray<uint8> RevealBytes;
+						TArray<uint8> LandBytes;
+						Campaign.Reveal.ExpandToBytes(RevealBytes, 255);
+						Campaign.Land.ExpandToBytes(LandBytes, 1);
+						Ar << RevealBytes;
+						Ar << LandBytes;
+					});
+				},
+				[&Campaign](const FFCCampaignSnapshot& S)
+				{
+					FFCWorldMapBitMask Reveal(GlobalSize, GlobalSize);
+					FFCWorldMapBitMask Land(GlobalSize, GlobalSize);
+					bool bSizesOk = false;
+					const bool bRead = S.ReadSection(LegacyWorldMapSectionId, [&](FArchive& Ar, uint16 Version)
+					{
+						TArray<uint8> RevealBytes;
+						TArray<uint8> LandBytes;
+						Ar << RevealBytes;
+						Ar << LandBytes;
+						bSizesOk = RevealBytes.Num() == FFCWorldMapExploration::GlobalCount && LandBytes.Num() == FFCWorldMapExploration::GlobalCount;
+						if (bSizesOk)
+						{
+							Reveal.FromBytes(RevealBytes, 128);
+							Land.FromBytes(LandBytes, 1);
+						}
+					});
+					return bRead && bSizesOk && Reveal == Campaign.Reveal && Land == Campaign.Land;
+				});
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFCSaveBenchmarkTest, "FC.Save.Benchmark",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFCSaveBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace FCSaveBenchmark;
+
+	const int32 Iterations = FMath::Max(1, CVarIterations.GetValueOnGameThread());
+	const int32 RouteLength = FMath::Max(1, CVarRouteLength.GetValueOnGameThread());
+	const float SaveBudgetMs = CVarSaveBudgetMs.GetValueOnGameThread();
+	const float LoadBudgetMs = CVarLoadBudgetMs.GetValueOnGameThread();
+	const int32 FileBudgetBytes = CVarFileBudgetKB.GetValueOnGameThread() * 1024;
+
+	AddInfo(FString::Printf(TEXT("%d iterations, route length %d, budgets save %.1f ms / load %.1f ms / %d KB"),
+		Iterations, RouteLength, SaveBudgetMs, LoadBudgetMs, FileBudgetBytes / 1024));
+
+	// A private save manager: same write/load code as the game's, without touching its slot index.
+	TStrongObjectPtr<UFCSaveManager> SaveManager(NewObject<UFCSaveManager>());
+
+	TArray<FRow> Rows;
+	RunCase(*SaveManager, TEXT("PartialMap"), false, Iterations, RouteLength, Rows);
+	RunCase(*SaveManager, TEXT("FullMap"), true, Iterations, RouteLength, Rows);
+
+	SaveManager->FlushPendingWrites();
+	if (ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem())
+	{
+		SaveSystem->DeleteGame(false, SlotName, FPlatformMisc::GetPlatformUserForUserIndex(UserIndex));
+	}
+
+	// Per-phase medians; budgets apply to the worst iteration
+	FString Csv = TEXT("Case,Payload,Iterations,RawBytes,FileBytes,SerializeMs,WriteMs,ReadMs,DecompressMs,DeserializeMs,RestoreMs,SaveMaxMs,LoadMaxMs,RoundTrip,Result\n");
+	for (const FRow& Row : Rows)
+	{
+		const double SaveMaxMs = Max(Row.SaveMs);
+		const double LoadMaxMs = Max(Row.LoadMs);
+		const bool bPassed = Row.bRoundTripOk && SaveMaxMs <= SaveBudgetMs && LoadMaxMs <= LoadBudgetMs && Row.FileBytes <= FileBudgetBytes;
+
+		Csv += FString::Printf(TEXT("%s,%s,%d,%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%s,%s\n"),
+			*Row.Case, *Row.Payload, Row.SaveMs.Num(), Row.RawBytes, Row.FileBytes,
+			Median(Row.PhaseMs[Serialize]), Median(Row.PhaseMs[Write]), Median(Row.PhaseMs[Read]),
+			Median(Row.PhaseMs[Decompress]), Median(Row.PhaseMs[Deserialize]), Median(Row.PhaseMs[Restore]),
+			SaveMaxMs, LoadMaxMs, Row.bRoundTripOk ? TEXT("ok") : TEXT("MISMATCH"), bPassed ? TEXT("pass") : TEXT("FAIL"));
+
+		const FString Line = FString::Printf(TEXT("%-10s %-14s %7d -> %7d bytes  save %.3f ms  load %.3f ms%s"),
+			*Row.Case, *Row.Payload, Row.RawBytes, Row.FileBytes, SaveMaxMs, LoadMaxMs, Row.bRoundTripOk ? TEXT("") : TEXT("  round trip MISMATCH"));
+		if (bPassed)
+		{
+			AddInfo(Line);
+		}
+		else
+		{
+			AddError(Line);
+		}
+	}
+
+	// The WMAP section against the version 0 layout it replaced
+	for (const TCHAR* Case : { TEXT("PartialMap"), TEXT("FullMap") })
+	{
+		const FRow* Section = FindRow(Rows, Case, TEXT("Section.WMAP"));
+		const FRow* Legacy = FindRow(Rows, Case, TEXT("WorldMapV0"));
+		if (!Section || !Legacy)
+		{
+			continue;
+		}
+
+		AddInfo(FString::Printf(TEXT("%-10s world map: WMAP section %d bytes, v0 %d bytes; save %.3f / %.3f ms, load %.3f / %.3f ms"),
+			Case, Section->RawBytes, Legacy->RawBytes, Max(Section->SaveMs), Max(Legacy->SaveMs), Max(Section->LoadMs), Max(Legacy->LoadMs)));
+
+		if (Section->RawBytes >= Legacy->RawBytes)
+		{
+			AddError(FString::Printf(TEXT("%s: the WMAP section is not smaller than version 0"), Case));
+		}
+	}
+
+	const FString CsvPath = FPaths::ProjectSavedDir() / TEXT("Profiling") / FString::Printf(TEXT("FCSaveBenchmark_%s.csv"), *FDateTime::Now().ToString());
+	FFileHelper::SaveStringToFile(Csv, *CsvPath);
+	AddInfo(FString::Printf(TEXT("CSV: %s"), *CsvPath));
+
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFCWorldMapSaveFormatTest, "FC.Save.WorldMapFormat",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFCWorldMapSaveFormatTest::RunTest(const FString& Parameters)
+{
+	using namespace FCSaveBenchmark;
+
+	constexpr int32 GlobalSize = FFCWorldMapExploration::GlobalSize;
+
+	FRandomStream Random(42);
+	FCampaign Campaign;
+	MakeCampaign(false, Random, Campaign);
+
+	auto RoundTrip = [](FFCCampaignSnapshot& Written, FFCCampaignSnapshot& OutParsed)
+	{
+		TArray<uint8> Bytes;
+		Written.Serialize(Bytes);
+		return OutParsed.Parse(MoveTemp(Bytes));
+	};
+
+	// The land mask is left out while it matches the asset, and written when it does not
+	for (const bool bLandMatchesAsset : { true, false })
+	{
+		FFCCampaignSnapshot Written;
+		UFCExpeditionManager::WriteWorldMapSection(Written, Campaign.Reveal, Campaign.Land,
+			bLandMatchesAsset ? Campaign.AssetLandMaskHash : ~Campaign.AssetLandMaskHash);
+
+		FFCCampaignSnapshot Parsed;
+		FFCWorldMapBitMask Reveal(GlobalSize, GlobalSize);
+		FFCWorldMapBitMask Land(GlobalSize, GlobalSize);
+		bool bHasLand = false;
+		const FString What = bLandMatchesAsset ? TEXT("asset land mask") : TEXT("edited land mask");
+		TestTrue(What + TEXT(": section decodes"), RoundTrip(Written, Parsed) && UFCExpeditionManager::ReadWorldMapSection(Parsed, Reveal, Land, bHasLand));
+		TestTrue(What + TEXT(": reveal mask restored"), Reveal == Campaign.Reveal);
+		TestEqual(What + TEXT(": land mask stored"), bHasLand, !bLandMatchesAsset);
+		TestTrue(What + TEXT(": land mask restored"), bLandMatchesAsset || Land == Campaign.Land);
+	}
+
+	// A truncated payload and a newer section version are rejected
+	{
+		FFCCampaignSnapshot Written;
+		Written.AddSection(FCCampaignSection::WorldMap, 1, [&Campaign](FArchive& Ar)
+		{
+			TArray<uint64> RevealWords = Campaign.Reveal.GetWords();
+			Ar << RevealWords;
+		});
+
+		FFCCampaignSnapshot Parsed;
+		FFCWorldMapBitMask Reveal(GlobalSize, GlobalSize);
+		FFCWorldMapBitMask Land(GlobalSize, GlobalSize);
+		bool bHasLand = false;
+		TestFalse(TEXT("truncated section is rejected"), RoundTrip(Written, Parsed) && UFCExpeditionManager::ReadWorldMapSection(Parsed, Reveal, Land, bHasLand));
+	}
+	{
+		FFCCampaignSnapshot Written;
+		Written.AddSection(FCCampaignSection::WorldMap, MAX_uint16, [&Campaign](FArchive& Ar)
+		{
+			TArray<uint64> RevealWords = Campaign.Reveal.GetWords();
+			uint32 LandHash = Campaign.Land.GetHash();
+			bool bStoreLand = false;
+			Ar << RevealWords;
+			Ar << LandHash;
+			Ar << bStoreLand;
+		});
+
+		FFCCampaignSnapshot Parsed;
+		FFCWorldMapBitMask Reveal(GlobalSize, GlobalSize);
+		FFCWorldMapBitMask Land(GlobalSize, GlobalSize);
+		bool bHasLand = false;
+		TestFalse(TEXT("newer section version is rejected"), RoundTrip(Written, Parsed) && UFCExpeditionManager::ReadWorldMapSection(Parsed, Reveal, Land, bHasLand));
+	}
+
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -53,4 +53,8 @@ public:
 	/** Game version when this save was created */
 	UPROPERTY(VisibleAnywhere, Category = "Meta")
 	FString GameVersion;
+
+	/** FFCCampaignSnapshot bytes: game state, current expedition and world map (empty in older saves) */
+	UPROPERTY()
+	TArray<uint8> CampaignSnapshot;
 };
@@ -0,0 +1,815 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#include "SaveGame/FCSaveManager.h"
+
+#include "Async/Async.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/Texture2D.h"
+#include "GameFramework/SaveGame.h"
+#include "HAL/FileManager.h"
+#include "ImageUtils.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "PlatformFeatures.h"
+#include "SaveGameSystem.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "TimerManager.h"
+#include "UObject/GarbageCollection.h"
+#include "UnrealClient.h"
+#include "SaveGame/FCSaveGame.h"
+
+DEFINE_LOG_CATEGORY(LogFCSave);
+
+namespace FCSaveContainer
+{
+	/** 'FCSV' little-endian; plain engine save files start with 'GVAS' */
+	constexpr uint32 Magic = 0x56534346;
+
+	/** 1: magic, version, flags, raw size. 2: adds a CRC32 of the payload. */
+	constexpr uint16 Version = 2;
+
+	enum EFlags : uint16
+	{
+		None = 0,
+		Oodle = 1 << 0,
+	};
+
+	/** Magic + version + flags + raw size */
+	constexpr int32 HeaderSizeV1 = sizeof(uint32) + sizeof(uint16) + sizeof(uint16) + sizeof(int32);
+
+	/** V1 header + payload checksum */
+	constexpr int32 HeaderSize = HeaderSizeV1 + sizeof(uint32);
+}
+
+namespace FCSaveFiles
+{
+#if PLATFORM_DESKTOP
+	/** Same location the generic (desktop) ISaveGameSystem reads from */
+	FString GetSlotPath(const FString& SlotName)
+	{
+		return FPaths::ProjectSavedDir() / TEXT("SaveGames") / (SlotName + TEXT(".sav"));
+	}
+
+	FString GetTempPath(const FString& SlotName)
+	{
+		return GetSlotPath(SlotName) + TEXT(".tmp");
+	}
+
+	/**
+	 * Write the temp file completely, then move it over the slot. A crash mid-write only
+	 * tears the temp file; a crash between replace steps leaves a complete temp file that
+	 * LoadNow recovers.
+	 */
+	bool WriteAtomic(const FString& SlotName, const TArray<uint8>& FileData)
+	{
+		const FString TempPath = GetTempPath(SlotName);
+		if (!FFileHelper::SaveArrayToFile(FileData, *TempPath))
+		{
+			return false;
+		}
+		return IFileManager::Get().Move(*GetSlotPath(SlotName), *TempPath, true, true, false, true);
+	}
+#endif
+}
+
+namespace FCSaveSlotIndexFile
+{
+	const TCHAR* SlotName = TEXT("FC_SaveIndex");
+
+	/** JPEG quality of slot thumbnails */
+	constexpr int32 ThumbnailQuality = 80;
+
+	/** Box-filter Colors down to TargetWidth (keeping the aspect) and JPEG-encode the result */
+	void EncodeThumbnail(int32 Width, int32 Height, const TArray<FColor>& Colors, int32 TargetWidth, TArray<uint8>& OutThumbnail)
+	{
+		const int32 ThumbWidth = FMath::Min(TargetWidth, Width);
+		const int32 ThumbHeight = FMath::Max(1, FMath::RoundToInt(static_cast<float>(Height) * ThumbWidth / Width));
+
+		TArray<FColor> Pixels;
+		Pixels.SetNumUninitialized(ThumbWidth * ThumbHeight);
+		for (int32 Y = 0; Y < ThumbHeight; ++Y)
+		{
+			const int32 SrcY0 = Y * Height / ThumbHeight;
+			const int32 SrcY1 = FMath::Max(SrcY0 + 1, (Y + 1) * Height / ThumbHeight);
+			for (int32 X = 0; X < ThumbWidth; ++X)
+			{
+				const int32 SrcX0 = X * Width / ThumbWidth;
+				const int32 SrcX1 = FMath::Max(SrcX0 + 1, (X + 1) * Width / ThumbWidth);
+
+				uint32 R = 0, G = 0, B = 0;
+				for (int32 SrcY = SrcY0; SrcY < SrcY1; ++SrcY)
+				{
+					const FColor* Row = Colors.GetData() + SrcY * Width;
+					for (int32 SrcX = SrcX0; SrcX < SrcX1; ++SrcX)
+					{
+						R += Row[SrcX].R;
+						G += Row[SrcX].G;
+						B += Row[SrcX].B;
+					}
+				}
+				const uint32 Count = (SrcY1 - SrcY0) * (SrcX1 - SrcX0);
+				Pixels[Y * ThumbWidth + X] = FColor(R / Count, G / Count, B / Count, 255);
+			}
+		}
+
+		TArray64<uint8> Compressed;
+		OutThumbnail.Reset();
+		if (FImageUtils::CompressImage(Compressed, TEXT("jpg"), FImageView(Pixels.GetData(), ThumbWidth, ThumbHeight), ThumbnailQuality))
+		{
+			OutThumbnail.Append(Compressed.GetData(), static_cast<int32>(Compressed.Num()));
+		}
+	}
+}
+
+void UFCSaveManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	bShutDown = false;
+	LoadSlotIndex();
+	UE_LOG(LogFCSave, Log, TEXT("UFCSaveManager initialized (%d indexed saves)"), SlotInfos.Num());
+}
+
+void UFCSaveManager::Deinitialize()
+{
+	if (ScreenshotCapturedHandle.IsValid())
+	{
+		UGameViewportClient::OnScreenshotCaptured().Remove(ScreenshotCapturedHandle);
+		ScreenshotCapturedHandle.Reset();
+	}
+
+	// Entries still waiting for a thumbnail go out without it.
+	OnThumbnailWaitExpired();
+
+	const int32 NumPending = GetNumPendingWrites();
+	FlushPendingWrites();
+	bShutDown = true;
+
+	UE_LOG(LogFCSave, Log, TEXT("UFCSaveManager deinitialized (flushed %d pending writes)"), NumPending);
+	Super::Deinitialize();
+}
+
+// -----------------------------------------------------------------------------
+// Writes
+// -----------------------------------------------------------------------------
+
+bool UFCSaveManager::SaveGameToSlotAsync(USaveGame* SaveGame, const FString& SlotName, int32 UserIndex, FFCOnSaveWriteComplete OnComplete)
+{
+	TArray<uint8> SaveData;
+	if (!SaveGame || !UGameplayStatics::SaveGameToMemory(SaveGame, SaveData))
+	{
+		UE_LOG(LogFCSave, Error, TEXT("SaveGameToSlotAsync: Failed to serialize save game for slot %s"), *SlotName);
+		return false;
+	}
+
+	WriteSaveDataAsync(MoveTemp(SaveData), SlotName, UserIndex, MoveTemp(OnComplete));
+	return true;
+}
+
+void UFCSaveManager::WriteSaveDataAsync(TArray<uint8>&& SaveData, const FString& SlotName, int32 UserIndex, FFCOnSaveWriteComplete OnComplete)
+{
+	check(IsInGameThread());
+
+	const uint32 RequestId = NextRequestId++;
+
+	if (bShutDown)
+	{
+		// Nothing would be left to drain the completion queue; write inline.
+		const FWriteResult Result = WriteNow(RequestId, SlotName, UserIndex, SaveData);
+		OnComplete.ExecuteIfBound(SlotName, Result.bSuccess);
+		OnSaveWriteCompleted.Broadcast(SlotName, Result.bSuccess);
+		return;
+	}
+
+	if (OnComplete.IsBound())
+	{
+		PendingCallbacks.Add(RequestId, MoveTemp(OnComplete));
+	}
+
+	FPendingSlot& Pending = PendingSlots.FindOrAdd(MakeSlotKey(SlotName, UserIndex));
+	++Pending.NumPending;
+
+	TSharedRef<FResultQueue, ESPMode::ThreadSafe> Results = CompletedWrites;
+	TWeakObjectPtr<UFCSaveManager> WeakThis(this);
+
+	auto WriteTask = [RequestId, SlotName, UserIndex, SaveData = MoveTemp(SaveData), Results, WeakThis]()
+	{
+		Results->Enqueue(WriteNow(RequestId, SlotName, UserIndex, SaveData));
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis]()
+		{
+			if (UFCSaveManager* StrongThis = WeakThis.Get())
+			{
+				StrongThis->ProcessCompletedWrites();
+			}
+		});
+	};
+
+	// Chain behind the slot's previous write so the last queued state is the one left on disk.
+	Pending.Tail = Pending.Tail.IsValid()
+		? UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(WriteTask), UE::Tasks::Prerequisites(Pending.Tail))
+		: UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(WriteTask));
+}
+
+UFCSaveManager::FWriteResult UFCSaveManager::WriteNow(uint32 RequestId, const FString& SlotName, int32 UserIndex, const TArray<uint8>& SaveData)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	FWriteResult Result;
+	Result.RequestId = RequestId;
+	Result.SlotName = SlotName;
+	Result.UserIndex = UserIndex;
+
+	TArray<uint8> FileData;
+	EncodeSaveData(SaveData, FileData);
+	Result.FileBytes = FileData.Num();
+
+#if PLATFORM_DESKTOP
+	Result.bSuccess = FCSaveFiles::WriteAtomic(SlotName, FileData);
+#else
+	if (ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem())
+	{
+		Result.bSuccess = SaveSystem->SaveGame(false, *SlotName, FPlatformMisc::GetPlatformUserForUserIndex(UserIndex), FileData);
+	}
+#endif
+
+	Result.WorkerMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	return Result;
+}
+
+void UFCSaveManager::ProcessCompletedWrites()
+{
+	check(IsInGameThread());
+
+	FWriteResult Result;
+	while (CompletedWrites->Dequeue(Result))
+	{
+		CompleteWrite(Result);
+	}
+}
+
+void UFCSaveManager::CompleteWrite(const FWriteResult& Result)
+{
+	const FString SlotKey = MakeSlotKey(Result.SlotName, Result.UserIndex);
+	if (FPendingSlot* Pending = PendingSlots.Find(SlotKey))
+	{
+		if (--Pending->NumPending <= 0)
+		{
+			PendingSlots.Remove(SlotKey);
+		}
+	}
+
+	if (Result.bSuccess)
+	{
+		UE_LOG(LogFCSave, Verbose, TEXT("Wrote slot %s: %d bytes in %.2f ms (background)"),
+			*Result.SlotName, Result.FileBytes, Result.WorkerMs);
+	}
+	else
+	{
+		UE_LOG(LogFCSave, Error, TEXT("Failed to write slot %s"), *Result.SlotName);
+	}
+
+	FFCOnSaveWriteComplete OnComplete;
+	if (PendingCallbacks.RemoveAndCopyValue(Result.RequestId, OnComplete))
+	{
+		OnComplete.ExecuteIfBound(Result.SlotName, Result.bSuccess);
+	}
+	OnSaveWriteCompleted.Broadcast(Result.SlotName, Result.bSuccess);
+}
+
+void UFCSaveManager::FlushPendingWrites()
+{
+	check(IsInGameThread());
+
+	for (const TPair<FString, FPendingSlot>& Pair : PendingSlots)
+	{
+		Pair.Value.Tail.Wait();
+	}
+	ProcessCompletedWrites();
+}
+
+void UFCSaveManager::WaitForSlot(const FString& SlotKey)
+{
+	if (const FPendingSlot* Pending = PendingSlots.Find(SlotKey))
+	{
+		Pending->Tail.Wait();
+		ProcessCompletedWrites();
+	}
+}
+
+int32 UFCSaveManager::GetNumPendingWrites() const
+{
+	int32 NumPending = 0;
+	for (const TPair<FString, FPendingSlot>& Pair : PendingSlots)
+	{
+		NumPending += Pair.Value.NumPending;
+	}
+	return NumPending;
+}
+
+bool UFCSaveManager::IsSlotWritePending(const FString& SlotName, int32 UserIndex) const
+{
+	return PendingSlots.Contains(MakeSlotKey(SlotName, UserIndex));
+}
+
+FString UFCSaveManager::MakeSlotKey(const FString& SlotName, int32 UserIndex)
+{
+	return FString::Printf(TEXT("%s#%d"), *SlotName, UserIndex);
+}
+
+// -----------------------------------------------------------------------------
+// Reads
+// -----------------------------------------------------------------------------
+
+bool UFCSaveManager::DoesSaveGameExist(const FString& SlotName, int32 UserIndex) const
+{
+	if (IsSlotWritePending(SlotName, UserIndex) || UGameplayStatics::DoesSaveGameExist(SlotName, UserIndex))
+	{
+		return true;
+	}
+#if PLATFORM_DESKTOP
+	// Interrupted replace: only the (complete) temp file is left, LoadNow picks it up
+	return IFileManager::Get().FileExists(*FCSaveFiles::GetTempPath(SlotName));
+#else
+	return false;
+#endif
+}
+
+USaveGame* UFCSaveManager::LoadGameFromSlot(const FString& SlotName, int32 UserIndex)
+{
+	WaitForSlot(MakeSlotKey(SlotName, UserIndex));
+
+	FFCSaveLoadTimings Timings;
+	return LoadNow(SlotName, UserIndex, Timings);
+}
+
+void UFCSaveManager::LoadGameFromSlotAsync(const FString& SlotName, int32 UserIndex, FFCOnSaveLoadComplete OnComplete)
+{
+	check(IsInGameThread());
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	auto LoadTask = [SlotName, UserIndex, OnComplete = MoveTemp(OnComplete), StartTime]() mutable
+	{
+		FFCSaveLoadTimings Timings;
+		USaveGame* Loaded = LoadNow(SlotName, UserIndex, Timings);
+
+		AsyncTask(ENamedThreads::GameThread, [Loaded, Timings, OnComplete = MoveTemp(OnComplete), StartTime]() mutable
+		{
+			if (Loaded)
+			{
+				// Back on the game thread: hand the object over to normal GC rules.
+				Loaded->ClearInternalFlags(EInternalObjectFlags::Async);
+			}
+			Timings.TotalMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+			OnComplete.ExecuteIfBound(Loaded, Timings);
+		});
+	};
+
+	// Read after the slot's queued writes, never before them.
+	const FPendingSlot* Pending = PendingSlots.Find(MakeSlotKey(SlotName, UserIndex));
+	if (Pending && Pending->Tail.IsValid())
+	{
+		UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(LoadTask), UE::Tasks::Prerequisites(Pending->Tail));
+	}
+	else
+	{
+		UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(LoadTask));
+	}
+}
+
+USaveGame* UFCSaveManager::LoadNow(const FString& SlotName, int32 UserIndex, FFCSaveLoadTimings& OutTimings)
+{
+	double PhaseStart = FPlatformTime::Seconds();
+
+	TArray<uint8> FileData;
+	ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+	const bool bRead = SaveSystem && SaveSystem->LoadGame(false, *SlotName, FPlatformMisc::GetPlatformUserForUserIndex(UserIndex), FileData);
+	OutTimings.FileBytes = FileData.Num();
+	OutTimings.ReadMs = static_cast<float>((FPlatformTime::Seconds() - PhaseStart) * 1000.0);
+
+	PhaseStart = FPlatformTime::Seconds();
+	TArray<uint8> SaveData;
+	bool bDecoded = bRead && DecodeSaveData(FileData, SaveData);
+	if (bRead && !bDecoded)
+	{
+		UE_LOG(LogFCSave, Error, TEXT("LoadGameFromSlot: Slot %s is corrupt (checksum or decompression failed)"), *SlotName);
+	}
+
+#if PLATFORM_DESKTOP
+	if (!bDecoded)
+	{
+		// A complete temp file means the replace step was interrupted; it holds the newest data.
+		const FString TempPath = FCSaveFiles::GetTempPath(SlotName);
+		if (FFileHelper::LoadFileToArray(FileData, *TempPath, FILEREAD_Silent) && DecodeSaveData(FileData, SaveData))
+		{
+			UE_LOG(LogFCSave, Warning, TEXT("LoadGameFromSlot: Recovered slot %s from its temp file"), *SlotName);
+			OutTimings.FileBytes = FileData.Num();
+			bDecoded = true;
+		}
+	}
+#endif
+
+	if (!bDecoded)
+	{
+		return nullptr;
+	}
+	OutTimings.DecompressMs = static_cast<float>((FPlatformTime::Seconds() - PhaseStart) * 1000.0);
+
+	PhaseStart = FPlatformTime::Seconds();
+	USaveGame* Loaded = nullptr;
+	if (IsInGameThread())
+	{
+		Loaded = UGameplayStatics::LoadGameFromMemory(SaveData);
+	}
+	else
+	{
+		// Off the game thread: keep GC out while the object is created, and flag it Async
+		// so it survives until the game thread takes ownership.
+		FGCScopeGuard GCGuard;
+		Loaded = UGameplayStatics::LoadGameFromMemory(SaveData);
+		if (Loaded)
+		{
+			Loaded->SetInternalFlags(EInternalObjectFlags::Async);
+		}
+	}
+	OutTimings.DeserializeMs = static_cast<float>((FPlatformTime::Seconds() - PhaseStart) * 1000.0);
+
+	return Loaded;
+}
+
+// -----------------------------------------------------------------------------
+// Container encoding
+// -----------------------------------------------------------------------------
+
+void UFCSaveManager::EncodeSaveData(const TArray<uint8>& SaveData, TArray<uint8>& OutFileData)
+{
+	int32 RawSize = SaveData.Num();
+
+	TArray<uint8> Compressed;
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Oodle, RawSize);
+	Compressed.SetNumUninitialized(CompressedSize);
+
+	uint16 Flags = FCSaveContainer::None;
+	if (RawSize > 0
+		&& FCompression::CompressMemory(NAME_Oodle, Compressed.GetData(), CompressedSize, SaveData.GetData(), RawSize)
+		&& CompressedSize < RawSize)
+	{
+		Flags |= FCSaveContainer::Oodle;
+	}
+
+	const bool bCompressed = (Flags & FCSaveContainer::Oodle) != 0;
+	const uint8* Payload = bCompressed ? Compressed.GetData() : SaveData.GetData();
+	const int32 PayloadSize = bCompressed ? CompressedSize : RawSize;
+
+	OutFileData.Reset(FCSaveContainer::HeaderSize + PayloadSize);
+	FMemoryWriter Writer(OutFileData);
+
+	uint32 Magic = FCSaveContainer::Magic;
+	uint16 Version = FCSaveContainer::Version;
+	uint32 Checksum = FCrc::MemCrc32(Payload, PayloadSize);
+	Writer << Magic;
+	Writer << Version;
+	Writer << Flags;
+	Writer << RawSize;
+	Writer << Checksum;
+	Writer.Serialize(const_cast<uint8*>(Payload), PayloadSize);
+}
+
+bool UFCSaveManager::DecodeSaveData(const TArray<uint8>& FileData, TArray<uint8>& OutSaveData)
+{
+	uint32 Magic = 0;
+	if (FileData.Num() >= FCSaveContainer::HeaderSizeV1)
+	{
+		FMemory::Memcpy(&Magic, FileData.GetData(), sizeof(Magic));
+	}
+
+	if (Magic != FCSaveContainer::Magic)
+	{
+		// Written by SaveGameToSlot before the container existed.
+		OutSaveData = FileData;
+		return true;
+	}
+
+	FMemoryReader Reader(FileData);
+	uint16 Version = 0;
+	uint16 Flags = 0;
+	int32 RawSize = 0;
+	Reader << Magic;
+	Reader << Version;
+	Reader << Flags;
+	Reader << RawSize;
+
+	uint32 Checksum = 0;
+	if (Version >= 2)
+	{
+		Reader << Checksum;
+	}
+
+	if (Reader.IsError() || Version > FCSaveContainer::Version || RawSize < 0)
+	{
+		return false;
+	}
+
+	const int32 HeaderSize = static_cast<int32>(Reader.Tell());
+	const uint8* Payload = FileData.GetData() + HeaderSize;
+	const int32 PayloadSize = FileData.Num() - HeaderSize;
+
+	// Torn or bit-rotted files fail here instead of deserializing garbage
+	if (Version >= 2 && FCrc::MemCrc32(Payload, PayloadSize) != Checksum)
+	{
+		return false;
+	}
+
+	OutSaveData.SetNumUninitialized(RawSize);
+	if (Flags & FCSaveContainer::Oodle)
+	{
+		return FCompression::UncompressMemory(NAME_Oodle, OutSaveData.GetData(), RawSize, Payload, PayloadSize);
+	}
+
+	if (PayloadSize != RawSize)
+	{
+		return false;
+	}
+	FMemory::Memcpy(OutSaveData.GetData(), Payload, RawSize);
+	return true;
+}
+
+// -----------------------------------------------------------------------------
+// Slot index
+// -----------------------------------------------------------------------------
+
+bool UFCSaveManager::GetSlotInfo(const FString& SlotName, FFCSaveSlotInfo& OutInfo) const
+{
+	if (const int32* Index = SlotInfoLookup.Find(SlotName))
+	{
+		OutInfo = SlotInfos[*Index];
+		return true;
+	}
+	return false;
+}
+
+FString UFCSaveManager::GetMostRecentSlot() const
+{
+	return SlotInfos.Num() > 0 ? SlotInfos[0].SlotName : FString();
+}
+
+void UFCSaveManager::UpdateSlotInfo(const FFCSaveSlotInfo& Info)
+{
+	check(IsInGameThread());
+
+	FFCSaveSlotInfo Entry = Info;
+	if (const int32* Existing = SlotInfoLookup.Find(Info.SlotName))
+	{
+		if (Entry.Thumbnail.Num() == 0)
+		{
+			Entry.Thumbnail = MoveTemp(SlotInfos[*Existing].Thumbnail);
+		}
+		SlotInfos.RemoveAt(*Existing);
+	}
+
+	TArray<uint8> PendingThumbnail;
+	if (PendingThumbnails.RemoveAndCopyValue(Info.SlotName, PendingThumbnail))
+	{
+		Entry.Thumbnail = MoveTemp(PendingThumbnail);
+	}
+
+	// Keep newest first; a fresh save almost always lands at the front.
+	int32 InsertAt = 0;
+	while (InsertAt < SlotInfos.Num() && SlotInfos[InsertAt].Timestamp > Entry.Timestamp)
+	{
+		++InsertAt;
+	}
+	SlotInfos.Insert(MoveTemp(Entry), InsertAt);
+
+	RebuildSlotLookup();
+
+	// The thumbnail is still on its way; SetSlotThumbnail writes the index once it lands.
+	UGameInstance* GI = GetGameInstance();
+	if (GI && ThumbnailsInFlight.Contains(Info.SlotName))
+	{
+		SlotsAwaitingThumbnail.Add(Info.SlotName);
+		GI->GetTimerManager().SetTimer(ThumbnailWaitTimer, this, &UFCSaveManager::OnThumbnailWaitExpired, ThumbnailWaitSeconds, false);
+		return;
+	}
+	WriteSlotIndex();
+}
+
+void UFCSaveManager::RebuildSlotLookup()
+{
+	SlotInfoLookup.Reset();
+	for (int32 Index = 0; Index < SlotInfos.Num(); ++Index)
+	{
+		SlotInfoLookup.Add(SlotInfos[Index].SlotName, Index);
+	}
+}
+
+void UFCSaveManager::LoadSlotIndex()
+{
+	SlotInfos.Reset();
+
+	FFCSaveLoadTimings Timings;
+	if (UFCSaveSlotIndex* Index = Cast<UFCSaveSlotIndex>(LoadNow(FCSaveSlotIndexFile::SlotName, 0, Timings)))
+	{
+		SlotInfos = MoveTemp(Index->Slots);
+		SlotInfos.Sort([](const FFCSaveSlotInfo& A, const FFCSaveSlotInfo& B) { return A.Timestamp > B.Timestamp; });
+		RebuildSlotLookup();
+		UE_LOG(LogFCSave, Verbose, TEXT("Loaded slot index: %d entries, %d bytes in %.2f ms"),
+			SlotInfos.Num(), Timings.FileBytes, Timings.ReadMs + Timings.DecompressMs + Timings.DeserializeMs);
+		return;
+	}
+
+	RebuildSlotIndexFromSaves();
+}
+
+void UFCSaveManager::RebuildSlotIndexFromSaves()
+{
+	// One-time migration for saves written before the index existed (the old fixed slot names).
+	TArray<FString> LegacySlotNames;
+	for (int32 i = 1; i <= 3; ++i)
+	{
+		LegacySlotNames.Add(FString::Printf(TEXT("AutoSave_%03d"), i));
+	}
+	LegacySlotNames.Add(TEXT("QuickSave"));
+	for (int32 i = 1; i <= 10; ++i)
+	{
+		LegacySlotNames.Add(FString::Printf(TEXT("Manual_%03d"), i));
+	}
+
+	for (const FString& SlotName : LegacySlotNames)
+	{
+		if (!UGameplayStatics::DoesSaveGameExist(SlotName, 0))
+		{
+			continue;
+		}
+
+		FFCSaveLoadTimings Timings;
+		if (const UFCSaveGame* Save = Cast<UFCSaveGame>(LoadNow(SlotName, 0, Timings)))
+		{
+			FFCSaveSlotInfo& Info = SlotInfos.AddDefaulted_GetRef();
+			Info.SlotName = SlotName;
+			Info.Timestamp = Save->Timestamp;
+			Info.LevelName = Save->CurrentLevelName;
+			Info.GameVersion = Save->GameVersion;
+		}
+	}
+
+	SlotInfos.Sort([](const FFCSaveSlotInfo& A, const FFCSaveSlotInfo& B) { return A.Timestamp > B.Timestamp; });
+	RebuildSlotLookup();
+
+	// Write even an empty index so the probe never runs again.
+	WriteSlotIndex();
+	UE_LOG(LogFCSave, Log, TEXT("Built slot index from %d existing saves"), SlotInfos.Num());
+}
+
+void UFCSaveManager::WriteSlotIndex()
+{
+	UFCSaveSlotIndex* Index = NewObject<UFCSaveSlotIndex>(GetTransientPackage());
+	Index->Slots = SlotInfos;
+	SaveGameToSlotAsync(Index, FCSaveSlotIndexFile::SlotName, 0);
+}
+
+// -----------------------------------------------------------------------------
+// Thumbnails
+// -----------------------------------------------------------------------------
+
+void UFCSaveManager::CaptureSlotThumbnail(const FString& SlotName)
+{
+	check(IsInGameThread());
+
+	if (!FApp::CanEverRender() || !GEngine || !GEngine->GameViewport)
+	{
+		return;
+	}
+
+	// Saves requested in the same frame share one screenshot.
+	ThumbnailSlotNames.AddUnique(SlotName);
+	ThumbnailsInFlight.Add(SlotName);
+	if (ScreenshotCapturedHandle.IsValid())
+	{
+		return;
+	}
+
+	// While the delegate is bound the viewport hands us the pixels instead of writing a file.
+	ScreenshotCapturedHandle = UGameViewportClient::OnScreenshotCaptured().AddUObject(this, &UFCSaveManager::OnThumbnailScreenshotCaptured);
+	FScreenshotRequest::RequestScreenshot(false);
+}
+
+void UFCSaveManager::OnThumbnailScreenshotCaptured(int32 Width, int32 Height, const TArray<FColor>& Colors)
+{
+	UGameViewportClient::OnScreenshotCaptured().Remove(ScreenshotCapturedHandle);
+	ScreenshotCapturedHandle.Reset();
+
+	TArray<FString> SlotNames = MoveTemp(ThumbnailSlotNames);
+	if (Width <= 0 || Height <= 0 || Colors.Num() != Width * Height)
+	{
+		AbandonSlotThumbnails(SlotNames);
+		return;
+	}
+
+	// Downscale + JPEG on a worker; only the copy of the frame happens here.
+	TWeakObjectPtr<UFCSaveManager> WeakThis(this);
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [Width, Height, Colors, SlotNames = MoveTemp(SlotNames), WeakThis]() mutable
+	{
+		TArray<uint8> Thumbnail;
+		FCSaveSlotIndexFile::EncodeThumbnail(Width, Height, Colors, ThumbnailWidth, Thumbnail);
+
+		AsyncTask(ENamedThreads::GameThread, [Thumbnail = MoveTemp(Thumbnail), SlotNames = MoveTemp(SlotNames), WeakThis]()
+		{
+			UFCSaveManager* StrongThis = WeakThis.Get();
+			if (!StrongThis)
+			{
+				return;
+			}
+			if (Thumbnail.Num() == 0)
+			{
+				StrongThis->AbandonSlotThumbnails(SlotNames);
+				return;
+			}
+			for (const FString& SlotName : SlotNames)
+			{
+				StrongThis->SetSlotThumbnail(SlotName, CopyTemp(Thumbnail));
+			}
+		});
+	});
+}
+
+void UFCSaveManager::SetSlotThumbnail(const FString& SlotName, TArray<uint8>&& Thumbnail)
+{
+	ThumbnailsInFlight.Remove(SlotName);
+
+	// The screenshot usually arrives before the save write completes; park it until UpdateSlotInfo,
+	// which writes the entry and its thumbnail together.
+	const int32* Index = SlotInfoLookup.Find(SlotName);
+	if (!Index || !SlotsAwaitingThumbnail.Contains(SlotName))
+	{
+		PendingThumbnails.Add(SlotName, MoveTemp(Thumbnail));
+		return;
+	}
+
+	SlotInfos[*Index].Thumbnail = MoveTemp(Thumbnail);
+	SlotsAwaitingThumbnail.Remove(SlotName);
+	if (SlotsAwaitingThumbnail.Num() == 0)
+	{
+		if (UGameInstance* GI = GetGameInstance())
+		{
+			GI->GetTimerManager().ClearTimer(ThumbnailWaitTimer);
+		}
+	}
+	WriteSlotIndex();
+}
+
+void UFCSaveManager::AbandonSlotThumbnails(const TArray<FString>& SlotNames)
+{
+	bool bWasWaiting = false;
+	for (const FString& SlotName : SlotNames)
+	{
+		ThumbnailsInFlight.Remove(SlotName);
+		bWasWaiting |= SlotsAwaitingThumbnail.Remove(SlotName) > 0;
+	}
+
+	if (bWasWaiting)
+	{
+		WriteSlotIndex();
+	}
+}
+
+void UFCSaveManager::OnThumbnailWaitExpired()
+{
+	if (UGameInstance* GI = GetGameInstance())
+	{
+		GI->GetTimerManager().ClearTimer(ThumbnailWaitTimer);
+	}
+
+	if (SlotsAwaitingThumbnail.Num() == 0)
+	{
+		return;
+	}
+
+	// A thumbnail that still turns up is parked for the slot's next save.
+	for (const FString& SlotName : SlotsAwaitingThumbnail)
+	{
+		ThumbnailsInFlight.Remove(SlotName);
+	}
+	UE_LOG(LogFCSave, Verbose, TEXT("Slot index: writing %d entries without their thumbnails"), SlotsAwaitingThumbnail.Num());
+	SlotsAwaitingThumbnail.Reset();
+	WriteSlotIndex();
+}
+
+UTexture2D* UFCSaveManager::CreateSlotThumbnailTexture(const FString& SlotName) const
+{
+	const int32* Index = SlotInfoLookup.Find(SlotName);
+	if (!Index || SlotInfos[*Index].Thumbnail.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	const TArray<uint8>& Thumbnail = SlotInfos[*Index].Thumbnail;
+	return FImageUtils::ImportBufferAsTexture2D(TArrayView64<const uint8>(Thumbnail.GetData(), Thumbnail.Num()));
+}
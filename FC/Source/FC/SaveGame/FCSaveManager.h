@@ -0,0 +1,231 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Tasks/Task.h"
+#include "SaveGame/FCSaveSlotIndex.h"
+#include "FCSaveManager.generated.h"
+
+class USaveGame;
+class UTexture2D;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogFCSave, Log, All);
+
+/** Per-request completion (game thread): SlotName, bSuccess */
+DECLARE_DELEGATE_TwoParams(FFCOnSaveWriteComplete, const FString&, bool);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSaveWriteCompleted, const FString&, SlotName, bool, bSuccess);
+
+/** Where the time of a slot load went */
+USTRUCT(BlueprintType)
+struct FFCSaveLoadTimings
+{
+	GENERATED_BODY()
+
+	/** Platform save-system read */
+	UPROPERTY(BlueprintReadOnly, Category = "SaveGame")
+	float ReadMs = 0.f;
+
+	/** Container decompression */
+	UPROPERTY(BlueprintReadOnly, Category = "SaveGame")
+	float DecompressMs = 0.f;
+
+	/** USaveGame deserialization */
+	UPROPERTY(BlueprintReadOnly, Category = "SaveGame")
+	float DeserializeMs = 0.f;
+
+	/** Request to result on the game thread (includes waiting for queued writes to the slot) */
+	UPROPERTY(BlueprintReadOnly, Category = "SaveGame")
+	float TotalMs = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SaveGame")
+	int32 FileBytes = 0;
+};
+
+/** Async load completion (game thread): the loaded object (null on failure) and its timings */
+DECLARE_DELEGATE_TwoParams(FFCOnSaveLoadComplete, USaveGame*, const FFCSaveLoadTimings&);
+
+/**
+ * UFCSaveManager
+ *
+ * Game Instance subsystem that keeps save-file I/O off the game thread.
+ * - The game thread only serializes the USaveGame to memory (cheap for our save objects).
+ * - Compression and the platform save-system write run on a background task.
+ * - Writes to the same slot complete in the order they were queued; different slots run in parallel.
+ * - Completion callbacks and OnSaveWriteCompleted fire on the game thread.
+ * - Pending writes are flushed in Deinitialize; later requests are written synchronously.
+ *
+ * Files are wrapped in a small container (magic, version, flags, raw size, payload CRC32) so
+ * the payload can be compressed and torn writes are detected. Plain SaveGameToSlot files are
+ * still read by LoadGameFromSlot. On desktop, writes go to a temp file that is then moved over
+ * the slot, so a crash never leaves a half-written slot behind.
+ *
+ * Game saves are listed in a slot index (FC_SaveIndex) that is read once at startup and
+ * rewritten whenever an entry changes, so menus get slot names, timestamps, levels and
+ * thumbnails from memory.
+ */
+UCLASS()
+class FC_API UFCSaveManager : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Serialize SaveGame now and queue the write. Returns false (and never calls OnComplete)
+	 * if serialization failed; otherwise OnComplete runs once the slot is on disk.
+	 */
+	bool SaveGameToSlotAsync(USaveGame* SaveGame, const FString& SlotName, int32 UserIndex, FFCOnSaveWriteComplete OnComplete = FFCOnSaveWriteComplete());
+
+	/** Queue bytes produced by UGameplayStatics::SaveGameToMemory. */
+	void WriteSaveDataAsync(TArray<uint8>&& SaveData, const FString& SlotName, int32 UserIndex, FFCOnSaveWriteComplete OnComplete = FFCOnSaveWriteComplete());
+
+	/** Block until every queued write is on disk and its completion has fired. */
+	UFUNCTION(BlueprintCallable, Category = "SaveGame")
+	void FlushPendingWrites();
+
+	UFUNCTION(BlueprintPure, Category = "SaveGame")
+	int32 GetNumPendingWrites() const;
+
+	UFUNCTION(BlueprintPure, Category = "SaveGame")
+	bool IsSlotWritePending(const FString& SlotName, int32 UserIndex) const;
+
+	/** True if the slot exists on disk or a write to it is queued. */
+	UFUNCTION(BlueprintPure, Category = "SaveGame")
+	bool DoesSaveGameExist(const FString& SlotName, int32 UserIndex) const;
+
+	/** Synchronous load; waits for queued writes to the slot first so reads never see stale data. */
+	USaveGame* LoadGameFromSlot(const FString& SlotName, int32 UserIndex);
+
+	/**
+	 * Read, decompress and deserialize on a background task (after any queued write to the slot),
+	 * then call OnComplete on the game thread. The game thread never touches the disk.
+	 */
+	void LoadGameFromSlotAsync(const FString& SlotName, int32 UserIndex, FFCOnSaveLoadComplete OnComplete);
+
+	/** Fired on the game thread after every queued write */
+	UPROPERTY(BlueprintAssignable, Category = "SaveGame")
+	FOnSaveWriteCompleted OnSaveWriteCompleted;
+
+	// --- Container encoding (thread-safe) --------------------------------------
+
+	/** Wrap serialized USaveGame bytes in the save container, compressing when it pays off. */
+	static void EncodeSaveData(const TArray<uint8>& SaveData, TArray<uint8>& OutFileData);
+
+	/** Unwrap a save file into USaveGame bytes; false on checksum mismatch. Plain (un-wrapped) files pass through. */
+	static bool DecodeSaveData(const TArray<uint8>& FileData, TArray<uint8>& OutSaveData);
+
+	// --- Slot index ------------------------------------------------------------
+
+	/** Width of captured thumbnails; the height follows the viewport aspect */
+	static constexpr int32 ThumbnailWidth = 192;
+
+	/** A saved slot's index write waits this long for its thumbnail before going out without it */
+	static constexpr float ThumbnailWaitSeconds = 2.f;
+
+	/** Every indexed game save, newest first (no disk access) */
+	const TArray<FFCSaveSlotInfo>& GetSlotInfos() const { return SlotInfos; }
+
+	UFUNCTION(BlueprintPure, Category = "SaveGame")
+	bool GetSlotInfo(const FString& SlotName, FFCSaveSlotInfo& OutInfo) const;
+
+	/** Slot with the newest timestamp, empty if there is none */
+	UFUNCTION(BlueprintPure, Category = "SaveGame")
+	FString GetMostRecentSlot() const;
+
+	/**
+	 * Insert or replace Info's entry and queue an index write. An empty Thumbnail keeps the slot's current one.
+	 * While the slot's thumbnail is still being captured, the write waits for it, so each save writes the index once.
+	 */
+	void UpdateSlotInfo(const FFCSaveSlotInfo& Info);
+
+	/** Grab the next rendered frame (without UI) as the thumbnail of SlotName's pending save. No-op without a viewport. */
+	void CaptureSlotThumbnail(const FString& SlotName);
+
+	/** Decode a slot's thumbnail into a transient texture; null if the slot has none */
+	UFUNCTION(BlueprintCallable, Category = "SaveGame")
+	UTexture2D* CreateSlotThumbnailTexture(const FString& SlotName) const;
+
+private:
+	struct FWriteResult
+	{
+		uint32 RequestId = 0;
+		FString SlotName;
+		int32 UserIndex = 0;
+		bool bSuccess = false;
+		int32 FileBytes = 0;
+		double WorkerMs = 0.0;
+	};
+
+	struct FPendingSlot
+	{
+		/** Last write queued for the slot; the next write waits on it */
+		UE::Tasks::FTask Tail;
+		int32 NumPending = 0;
+	};
+
+	using FResultQueue = TQueue<FWriteResult, EQueueMode::Mpsc>;
+
+	/** Compress + write on the calling thread */
+	static FWriteResult WriteNow(uint32 RequestId, const FString& SlotName, int32 UserIndex, const TArray<uint8>& SaveData);
+
+	/** Read + decompress + deserialize on the calling thread (any thread) */
+	static USaveGame* LoadNow(const FString& SlotName, int32 UserIndex, FFCSaveLoadTimings& OutTimings);
+
+	static FString MakeSlotKey(const FString& SlotName, int32 UserIndex);
+
+	/** Game thread: run completions for every finished write */
+	void ProcessCompletedWrites();
+	void CompleteWrite(const FWriteResult& Result);
+
+	void WaitForSlot(const FString& SlotKey);
+
+	/** Read FC_SaveIndex, or build it once from the pre-index slot names */
+	void LoadSlotIndex();
+	void RebuildSlotIndexFromSaves();
+	void WriteSlotIndex();
+	void RebuildSlotLookup();
+
+	void OnThumbnailScreenshotCaptured(int32 Width, int32 Height, const TArray<FColor>& Colors);
+	void SetSlotThumbnail(const FString& SlotName, TArray<uint8>&& Thumbnail);
+
+	/** The capture for SlotNames failed; write the index for any entry that was waiting on it */
+	void AbandonSlotThumbnails(const TArray<FString>& SlotNames);
+
+	/** ThumbnailWaitSeconds ran out: write the waiting entries without their thumbnails */
+	void OnThumbnailWaitExpired();
+
+	TMap<FString, FPendingSlot> PendingSlots;
+	TMap<uint32, FFCOnSaveWriteComplete> PendingCallbacks;
+
+	/** Filled by workers, drained on the game thread; shared so late workers never outlive it */
+	TSharedRef<FResultQueue, ESPMode::ThreadSafe> CompletedWrites = MakeShared<FResultQueue, ESPMode::ThreadSafe>();
+
+	uint32 NextRequestId = 1;
+
+	/** Sorted by Timestamp, newest first */
+	TArray<FFCSaveSlotInfo> SlotInfos;
+	TMap<FString, int32> SlotInfoLookup;
+
+	/** Thumbnails that arrived before UpdateSlotInfo for their save */
+	TMap<FString, TArray<uint8>> PendingThumbnails;
+
+	/** Slots whose thumbnail is being captured or encoded */
+	TSet<FString> ThumbnailsInFlight;
+
+	/** Slots with an updated index entry whose write waits for the thumbnail */
+	TSet<FString> SlotsAwaitingThumbnail;
+	FTimerHandle ThumbnailWaitTimer;
+
+	/** Slots waiting for the requested screenshot; empty when no capture is in flight */
+	TArray<FString> ThumbnailSlotNames;
+	FDelegateHandle ScreenshotCapturedHandle;
+
+	/** Set once Deinitialize has flushed; later writes run synchronously */
+	bool bShutDown = false;
+};
@@ -0,0 +1,49 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/SaveGame.h"
+#include "FCSaveSlotIndex.generated.h"
+
+/** What the slot selector shows for one save, without opening the save itself */
+USTRUCT(BlueprintType)
+struct FFCSaveSlotInfo
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "SaveGame")
+	FString SlotName;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SaveGame")
+	FDateTime Timestamp;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SaveGame")
+	FString LevelName;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SaveGame")
+	FString GameVersion;
+
+	/** JPEG screenshot (UFCSaveManager::ThumbnailWidth wide); empty until captured */
+	UPROPERTY()
+	TArray<uint8> Thumbnail;
+};
+
+/**
+ * Metadata of every game save, kept in its own small slot so menus never
+ * deserialize full saves. Rewritten by UFCSaveManager whenever a save completes.
+ */
+UCLASS()
+class UFCSaveSlotIndex : public USaveGame
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr int32 CurrentVersion = 1;
+
+	UPROPERTY()
+	int32 Version = CurrentVersion;
+
+	UPROPERTY()
+	TArray<FFCSaveSlotInfo> Slots;
+};
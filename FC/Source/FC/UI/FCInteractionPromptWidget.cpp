@@ -0,0 +1,67 @@
+#include "UI/FCInteractionPromptWidget.h"
+
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+
+void UFCInteractionPromptWidget::ShowPrompt(AActor* Target, const FText& PromptText)
+{
+	PromptTarget = Target;
+	bHasScreenPosition = false;
+
+	SetPrompt(PromptText);
+
+	// Place it before the first paint, so it does not flash at the previous target.
+	UpdateScreenPosition();
+	SetVisibility(ESlateVisibility::Visible);
+}
+
+void UFCInteractionPromptWidget::HidePrompt()
+{
+	PromptTarget.Reset();
+	SetVisibility(ESlateVisibility::Hidden);
+}
+
+void UFCInteractionPromptWidget::SetPrompt(const FText& PromptText)
+{
+	OnPromptChanged(PromptText);
+}
+
+void UFCInteractionPromptWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	UpdateScreenPosition();
+}
+
+void UFCInteractionPromptWidget::UpdateScreenPosition()
+{
+	const AActor* Target = PromptTarget.Get();
+	APlayerController* PC = GetOwningPlayer();
+	if (!Target || !PC)
+	{
+		return;
+	}
+
+	FVector2D ScreenPos;
+	const bool bProjected = PC->ProjectWorldLocationToScreen(Target->GetActorLocation() + WorldOffset, ScreenPos);
+
+	// Behind the camera: fade out instead of hiding, so the widget keeps ticking.
+	if (bProjected != bOnScreen)
+	{
+		bOnScreen = bProjected;
+		SetRenderOpacity(bOnScreen ? 1.f : 0.f);
+	}
+
+	if (!bProjected)
+	{
+		return;
+	}
+
+	// Skip sub-pixel moves; SetPositionInViewport invalidates the viewport slot layout.
+	if (!bHasScreenPosition || !ScreenPos.Equals(LastScreenPosition, 0.5f))
+	{
+		bHasScreenPosition = true;
+		LastScreenPosition = ScreenPos;
+		SetPositionInViewport(ScreenPos);
+	}
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "FCInteractionPromptWidget.generated.h"
+
+/**
+ * Base C++ class for the interaction prompt ("E - Open Door").
+ *
+ * UFCInteractionComponent calls ShowPrompt / HidePrompt only when focus changes, so the text is
+ * pushed once per target. While visible, the widget follows its target on its own: the screen
+ * projection runs in NativeTick (hidden widgets do not tick) and only moves the widget when the
+ * projected position actually changed.
+ *
+ * Blueprint subclasses display the text in OnPromptChanged, or override SetPrompt natively.
+ */
+UCLASS(Abstract)
+class FC_API UFCInteractionPromptWidget : public UUserWidget
+{
+	GENERATED_BODY()
+
+public:
+	/** Show PromptText anchored to Target */
+	void ShowPrompt(AActor* Target, const FText& PromptText);
+
+	void HidePrompt();
+
+	AActor* GetPromptTarget() const { return PromptTarget.Get(); }
+
+protected:
+	/** Applies new prompt text; default forwards to OnPromptChanged */
+	virtual void SetPrompt(const FText& PromptText);
+
+	/** Display PromptText (called once per focus change) */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Interaction")
+	void OnPromptChanged(const FText& PromptText);
+
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+
+	/** Offset from the target's origin the prompt is anchored to (world units) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interaction")
+	FVector WorldOffset = FVector::ZeroVector;
+
+private:
+	/** Projects the target and moves the widget if the position changed; hides it off screen */
+	void UpdateScreenPosition();
+
+	TWeakObjectPtr<AActor> PromptTarget;
+
+	FVector2D LastScreenPosition = FVector2D::ZeroVector;
+	bool bHasScreenPosition = false;
+	bool bOnScreen = true;
+};
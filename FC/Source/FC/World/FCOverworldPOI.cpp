@@ -1,6 +1,7 @@
 // Copyright (c) 2024 @ Steffen Loebelt. All Rights Reserved.
 
 #include "World/FCOverworldPOI.h"
+#include "World/FCOverworldPOIRegistry.h"
 #include "Components/SceneComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/BoxComponent.h"
@@ -42,10 +43,25 @@ void AFCOverworldPOI::BeginPlay()
 {
 	Super::BeginPlay();
 
+	if (UFCOverworldPOIRegistry* Registry = GetWorld()->GetSubsystem<UFCOverworldPOIRegistry>())
+	{
+		Registry->RegisterPOI(this);
+	}
+
 	UE_LOG(LogFCOverworldPOI, Log, TEXT("POI '%s' spawned at %s"), 
 		*POIName, *GetActorLocation().ToString());
 }
 
+void AFCOverworldPOI::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UFCOverworldPOIRegistry* Registry = GetWorld()->GetSubsystem<UFCOverworldPOIRegistry>())
+	{
+		Registry->UnregisterPOI(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 // IFCInteractablePOI interface implementation
 TArray<FFCPOIActionData> AFCOverworldPOI::GetAvailableActions_Implementation() const
 {
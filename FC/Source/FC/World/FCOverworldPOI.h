@@ -29,7 +29,9 @@ public:
 	AFCOverworldPOI();
 
 protected:
+	/** Registers with UFCOverworldPOIRegistry */
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
 	/** Root component for POI hierarchy */
@@ -0,0 +1,401 @@
+// Copyright (c) 2024 @ Steffen Loebelt. All Rights Reserved.
+
+#include "World/FCOverworldPOIRegistry.h"
+#include "Core/UFCGameInstance.h"
+#include "Engine/World.h"
+#include "World/FCOverworldPOI.h"
+#include "WorldMap/FCWorldMapExploration.h"
+
+void UFCOverworldPOIRegistry::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	BucketHeads.Init(INDEX_NONE, NumBuckets);
+	Entries.Reserve(64);
+	EntryByPOI.Reserve(64);
+}
+
+void UFCOverworldPOIRegistry::Deinitialize()
+{
+	Entries.Empty();
+	BucketHeads.Empty();
+	EntryByPOI.Empty();
+	FreeHead = INDEX_NONE;
+
+	Super::Deinitialize();
+}
+
+bool UFCOverworldPOIRegistry::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFCOverworldPOIRegistry::ConfigureCellSize()
+{
+	const UWorld* World = GetWorld();
+	const UFCGameInstance* GI = World ? Cast<UFCGameInstance>(World->GetGameInstance()) : nullptr;
+	if (GI)
+	{
+		// One world-map cell, so grid cells line up with the fog and route textures.
+		const FVector2D Extent = GI->OverworldWorldMax - GI->OverworldWorldMin;
+		GridOrigin = GI->OverworldWorldMin;
+		CellSize = FMath::Min(Extent.X, Extent.Y) / FFCWorldMapExploration::GlobalSize;
+	}
+
+	if (CellSize <= KINDA_SMALL_NUMBER)
+	{
+		GridOrigin = FVector2D::ZeroVector;
+		CellSize = 10000.f;
+	}
+
+	UE_LOG(LogFCOverworldPOI, Log, TEXT("POI registry: cell size %.0f"), CellSize);
+}
+
+FIntPoint UFCOverworldPOIRegistry::WorldToCell(const FVector2D& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt((Location.X - GridOrigin.X) / CellSize),
+		FMath::FloorToInt((Location.Y - GridOrigin.Y) / CellSize));
+}
+
+int32 UFCOverworldPOIRegistry::CellToBucket(const FIntPoint& Cell)
+{
+	const uint32 Hash = (static_cast<uint32>(Cell.X) * 73856093u) ^ (static_cast<uint32>(Cell.Y) * 19349663u);
+	return static_cast<int32>(Hash & (NumBuckets - 1));
+}
+
+// -----------------------------------------------------------------------------
+// Registration
+// -----------------------------------------------------------------------------
+
+void UFCOverworldPOIRegistry::RegisterPOI(AFCOverworldPOI* POI)
+{
+	if (!POI)
+	{
+		return;
+	}
+
+	if (CellSize <= 0.f)
+	{
+		ConfigureCellSize();
+	}
+
+	int32 EntryIndex = INDEX_NONE;
+	if (const int32* Existing = EntryByPOI.Find(POI))
+	{
+		EntryIndex = *Existing;
+		UnlinkEntry(EntryIndex);
+	}
+	else if (FreeHead != INDEX_NONE)
+	{
+		EntryIndex = FreeHead;
+		FreeHead = Entries[EntryIndex].Next;
+		EntryByPOI.Add(POI, EntryIndex);
+	}
+	else
+	{
+		EntryIndex = Entries.AddDefaulted();
+		EntryByPOI.Add(POI, EntryIndex);
+	}
+
+	FEntry& Entry = Entries[EntryIndex];
+	Entry.POI = POI;
+	Entry.Location = FVector2D(POI->GetActorLocation());
+	Entry.Cell = WorldToCell(Entry.Location);
+	Entry.bInUse = true;
+
+	if (EntryByPOI.Num() == 1)
+	{
+		OccupiedMin = OccupiedMax = Entry.Cell;
+	}
+	else
+	{
+		OccupiedMin = OccupiedMin.ComponentMin(Entry.Cell);
+		OccupiedMax = OccupiedMax.ComponentMax(Entry.Cell);
+	}
+
+	LinkEntry(EntryIndex);
+}
+
+void UFCOverworldPOIRegistry::UnregisterPOI(AFCOverworldPOI* POI)
+{
+	int32 EntryIndex = INDEX_NONE;
+	if (!EntryByPOI.RemoveAndCopyValue(POI, EntryIndex))
+	{
+		return;
+	}
+
+	UnlinkEntry(EntryIndex);
+
+	FEntry& Entry = Entries[EntryIndex];
+	Entry.POI.Reset();
+	Entry.bInUse = false;
+	Entry.Next = FreeHead;
+	FreeHead = EntryIndex;
+}
+
+void UFCOverworldPOIRegistry::LinkEntry(int32 EntryIndex)
+{
+	int32& Head = BucketHeads[CellToBucket(Entries[EntryIndex].Cell)];
+	Entries[EntryIndex].Next = Head;
+	Head = EntryIndex;
+}
+
+void UFCOverworldPOIRegistry::UnlinkEntry(int32 EntryIndex)
+{
+	int32* Link = &BucketHeads[CellToBucket(Entries[EntryIndex].Cell)];
+	while (*Link != INDEX_NONE)
+	{
+		if (*Link == EntryIndex)
+		{
+			*Link = Entries[EntryIndex].Next;
+			Entries[EntryIndex].Next = INDEX_NONE;
+			return;
+		}
+		Link = &Entries[*Link].Next;
+	}
+}
+
+// -----------------------------------------------------------------------------
+// Queries
+// -----------------------------------------------------------------------------
+
+void UFCOverworldPOIRegistry::ForEachInCells(const FIntPoint& MinCell, const FIntPoint& MaxCell, TFunctionRef<void(const FEntry& Entry)> Visit) const
+{
+	if (EntryByPOI.Num() == 0)
+	{
+		return;
+	}
+
+	const FIntPoint Min = MinCell.ComponentMax(OccupiedMin);
+	const FIntPoint Max = MaxCell.ComponentMin(OccupiedMax);
+	if (Min.X > Max.X || Min.Y > Max.Y)
+	{
+		return;
+	}
+
+	// Past one cell per POI, walking every entry once is cheaper than walking the cells.
+	const int64 NumCells = static_cast<int64>(Max.X - Min.X + 1) * (Max.Y - Min.Y + 1);
+	if (NumCells > EntryByPOI.Num())
+	{
+		for (const FEntry& Entry : Entries)
+		{
+			if (Entry.bInUse && Entry.Cell.X >= Min.X && Entry.Cell.X <= Max.X && Entry.Cell.Y >= Min.Y && Entry.Cell.Y <= Max.Y)
+			{
+				Visit(Entry);
+			}
+		}
+		return;
+	}
+
+	for (int32 CellY = Min.Y; CellY <= Max.Y; ++CellY)
+	{
+		for (int32 CellX = Min.X; CellX <= Max.X; ++CellX)
+		{
+			const FIntPoint Cell(CellX, CellY);
+			for (int32 Index = BucketHeads[CellToBucket(Cell)]; Index != INDEX_NONE; Index = Entries[Index].Next)
+			{
+				// Buckets are shared between cells; only this cell's entries count here.
+				if (Entries[Index].Cell == Cell)
+				{
+					Visit(Entries[Index]);
+				}
+			}
+		}
+	}
+}
+
+void UFCOverworldPOIRegistry::ForEachInRadius(const FVector2D& Center, float Radius, FVisitFunc Visit) const
+{
+	if (CellSize <= 0.f || Radius < 0.f)
+	{
+		return;
+	}
+
+	const float RadiusSq = FMath::Square(Radius);
+	ForEachInCells(WorldToCell(Center - FVector2D(Radius)), WorldToCell(Center + FVector2D(Radius)), [&](const FEntry& Entry)
+	{
+		const float DistanceSq = FVector2D::DistSquared(Entry.Location, Center);
+		AFCOverworldPOI* POI = Entry.POI.Get();
+		if (DistanceSq <= RadiusSq && POI)
+		{
+			Visit(POI, DistanceSq);
+		}
+	});
+}
+
+int32 UFCOverworldPOIRegistry::QueryRadius(const FVector2D& Center, float Radius, TArray<AFCOverworldPOI*>& OutPOIs) const
+{
+	OutPOIs.Reset();
+	ForEachInRadius(Center, Radius, [&OutPOIs](AFCOverworldPOI* POI, float)
+	{
+		OutPOIs.Add(POI);
+	});
+	return OutPOIs.Num();
+}
+
+void UFCOverworldPOIRegistry::ForEachInRect(const FBox2D& Rect, FVisitFunc Visit) const
+{
+	if (CellSize <= 0.f || !Rect.bIsValid)
+	{
+		return;
+	}
+
+	ForEachInCells(WorldToCell(Rect.Min), WorldToCell(Rect.Max), [&](const FEntry& Entry)
+	{
+		AFCOverworldPOI* POI = Entry.POI.Get();
+		if (POI && Entry.Location.X >= Rect.Min.X && Entry.Location.X <= Rect.Max.X
+			&& Entry.Location.Y >= Rect.Min.Y && Entry.Location.Y <= Rect.Max.Y)
+		{
+			Visit(POI, 0.f);
+		}
+	});
+}
+
+int32 UFCOverworldPOIRegistry::QueryRect(const FBox2D& Rect, TArray<AFCOverworldPOI*>& OutPOIs) const
+{
+	OutPOIs.Reset();
+	ForEachInRect(Rect, [&OutPOIs](AFCOverworldPOI* POI, float)
+	{
+		OutPOIs.Add(POI);
+	});
+	return OutPOIs.Num();
+}
+
+int32 UFCOverworldPOIRegistry::QueryNearest(const FVector2D& Center, int32 K, float MaxRadius, TArray<AFCOverworldPOI*>& OutPOIs) const
+{
+	OutPOIs.Reset();
+	if (CellSize <= 0.f || EntryByPOI.Num() == 0 || K <= 0)
+	{
+		return 0;
+	}
+
+	K = FMath::Min(K, MaxNearest);
+	const float MaxDistanceSq = MaxRadius > 0.f ? FMath::Square(MaxRadius) : MAX_flt;
+
+	// Best K so far, nearest first (inline storage: no heap allocation).
+	TArray<TPair<float, AFCOverworldPOI*>, TInlineAllocator<MaxNearest>> Best;
+
+	auto Consider = [&](const FEntry& Entry)
+	{
+		AFCOverworldPOI* POI = Entry.POI.Get();
+		const float DistanceSq = POI ? FVector2D::DistSquared(Entry.Location, Center) : MAX_flt;
+		if (!POI || DistanceSq > MaxDistanceSq || (Best.Num() == K && DistanceSq >= Best.Last().Key))
+		{
+			return;
+		}
+
+		int32 Insert = Best.Num();
+		while (Insert > 0 && Best[Insert - 1].Key > DistanceSq)
+		{
+			--Insert;
+		}
+		if (Best.Num() == K)
+		{
+			Best.Pop(EAllowShrinking::No);
+		}
+		Best.Insert(TPair<float, AFCOverworldPOI*>(DistanceSq, POI), Insert);
+	};
+
+	// Entries seen in the rings so far; once it reaches the registered count there is nothing left to find.
+	int32 NumSeen = 0;
+	auto VisitCell = [&](const FIntPoint& Cell)
+	{
+		if (Cell.X < OccupiedMin.X || Cell.Y < OccupiedMin.Y || Cell.X > OccupiedMax.X || Cell.Y > OccupiedMax.Y)
+		{
+			return;
+		}
+
+		for (int32 Index = BucketHeads[CellToBucket(Cell)]; Index != INDEX_NONE; Index = Entries[Index].Next)
+		{
+			if (Entries[Index].Cell == Cell)
+			{
+				++NumSeen;
+				Consider(Entries[Index]);
+			}
+		}
+	};
+
+	const FIntPoint CenterCell = WorldToCell(Center);
+	const int32 MaxRing = FMath::Max(
+		FMath::Max(FMath::Abs(CenterCell.X - OccupiedMin.X), FMath::Abs(CenterCell.X - OccupiedMax.X)),
+		FMath::Max(FMath::Abs(CenterCell.Y - OccupiedMin.Y), FMath::Abs(CenterCell.Y - OccupiedMax.Y)));
+
+	const int32 NumPOIs = EntryByPOI.Num();
+	int64 CellsProbed = 0;
+	for (int32 Ring = 0; Ring <= MaxRing && NumSeen < NumPOIs; ++Ring)
+	{
+		// Anything outside rings 0..Ring-1 is at least (Ring - 1) cells from the centre.
+		const float RingDistance = FMath::Max(0, Ring - 1) * CellSize;
+		const float RingDistanceSq = FMath::Square(RingDistance);
+		if (RingDistanceSq > MaxDistanceSq || (Best.Num() == K && Best.Last().Key <= RingDistanceSq))
+		{
+			break;
+		}
+
+		if (Ring == 0)
+		{
+			VisitCell(CenterCell);
+			++CellsProbed;
+			continue;
+		}
+
+		// Sparse POIs far out: once the rings would probe more cells than there are POIs,
+		// walk the entries outside the rings already searched instead (like ForEachInCells).
+		const int32 RingCells = 8 * Ring;
+		if (CellsProbed + RingCells > NumPOIs)
+		{
+			for (const FEntry& Entry : Entries)
+			{
+				if (Entry.bInUse && FMath::Max(FMath::Abs(Entry.Cell.X - CenterCell.X), FMath::Abs(Entry.Cell.Y - CenterCell.Y)) >= Ring)
+				{
+					Consider(Entry);
+				}
+			}
+			break;
+		}
+		CellsProbed += RingCells;
+
+		for (int32 X = CenterCell.X - Ring; X <= CenterCell.X + Ring; ++X)
+		{
+			VisitCell(FIntPoint(X, CenterCell.Y - Ring));
+			VisitCell(FIntPoint(X, CenterCell.Y + Ring));
+		}
+		for (int32 Y = CenterCell.Y - Ring + 1; Y <= CenterCell.Y + Ring - 1; ++Y)
+		{
+			VisitCell(FIntPoint(CenterCell.X - Ring, Y));
+			VisitCell(FIntPoint(CenterCell.X + Ring, Y));
+		}
+	}
+
+	for (const TPair<float, AFCOverworldPOI*>& Candidate : Best)
+	{
+		OutPOIs.Add(Candidate.Value);
+	}
+	return OutPOIs.Num();
+}
+
+// -----------------------------------------------------------------------------
+// Blueprint wrappers
+// -----------------------------------------------------------------------------
+
+TArray<AFCOverworldPOI*> UFCOverworldPOIRegistry::FindPOIsInRadius(FVector Center, float Radius) const
+{
+	TArray<AFCOverworldPOI*> Result;
+	QueryRadius(FVector2D(Center), Radius, Result);
+	return Result;
+}
+
+TArray<AFCOverworldPOI*> UFCOverworldPOIRegistry::FindPOIsInRect(FVector2D Min, FVector2D Max) const
+{
+	TArray<AFCOverworldPOI*> Result;
+	QueryRect(FBox2D(Min.ComponentMin(Max), Min.ComponentMax(Max)), Result);
+	return Result;
+}
+
+TArray<AFCOverworldPOI*> UFCOverworldPOIRegistry::FindNearestPOIs(FVector Center, int32 Count, float MaxRadius) const
+{
+	TArray<AFCOverworldPOI*> Result;
+	QueryNearest(FVector2D(Center), Count, MaxRadius, Result);
+	return Result;
+}
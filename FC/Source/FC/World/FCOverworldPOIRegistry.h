@@ -0,0 +1,117 @@
+// Copyright (c) 2024 @ Steffen Loebelt. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "FCOverworldPOIRegistry.generated.h"
+
+class AFCOverworldPOI;
+
+/**
+ * UFCOverworldPOIRegistry - Spatial index of the POIs in a world
+ *
+ * AFCOverworldPOI registers itself on BeginPlay and leaves on EndPlay. Positions (XY) go into a
+ * uniform grid whose cell edge is one world-map cell (UFCGameInstance::OverworldWorldMin/Max over
+ * the 256x256 map), hashed into a fixed bucket table, so "what is near here" needs no physics.
+ *
+ * Native queries fill caller-owned arrays (Reset, capacity kept) or call a visitor, and do not
+ * allocate. Large query areas fall back to a linear scan once that touches fewer entries.
+ */
+UCLASS()
+class FC_API UFCOverworldPOIRegistry : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Visitor for the native queries: POI and its squared 2D distance to the query centre (0 for rects) */
+	using FVisitFunc = TFunctionRef<void(AFCOverworldPOI* POI, float DistanceSq)>;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Add POI, or move it to its current location when already registered. */
+	void RegisterPOI(AFCOverworldPOI* POI);
+	void UnregisterPOI(AFCOverworldPOI* POI);
+
+	int32 GetNumPOIs() const { return EntryByPOI.Num(); }
+
+	/** Grid cell edge in world units */
+	float GetCellSize() const { return CellSize; }
+
+	// --- Native queries (no allocation) -----------------------------------
+
+	/** Every POI within Radius of Center (2D). */
+	void ForEachInRadius(const FVector2D& Center, float Radius, FVisitFunc Visit) const;
+	int32 QueryRadius(const FVector2D& Center, float Radius, TArray<AFCOverworldPOI*>& OutPOIs) const;
+
+	/** Every POI inside Rect (2D, edges inclusive). */
+	void ForEachInRect(const FBox2D& Rect, FVisitFunc Visit) const;
+	int32 QueryRect(const FBox2D& Rect, TArray<AFCOverworldPOI*>& OutPOIs) const;
+
+	/**
+	 * Up to K nearest POIs to Center within MaxRadius (<= 0 = unbounded), nearest first.
+	 * Searches grid rings outward and stops once no closer POI can exist or every POI has been seen;
+	 * when the rings would probe more cells than there are POIs it scans the rest linearly. K is capped at MaxNearest.
+	 */
+	int32 QueryNearest(const FVector2D& Center, int32 K, float MaxRadius, TArray<AFCOverworldPOI*>& OutPOIs) const;
+
+	/** Largest K served by QueryNearest without allocating */
+	static constexpr int32 MaxNearest = 32;
+
+	// --- Blueprint wrappers (return fresh arrays) -------------------------
+
+	UFUNCTION(BlueprintCallable, Category = "FC|POI")
+	TArray<AFCOverworldPOI*> FindPOIsInRadius(FVector Center, float Radius) const;
+
+	UFUNCTION(BlueprintCallable, Category = "FC|POI")
+	TArray<AFCOverworldPOI*> FindPOIsInRect(FVector2D Min, FVector2D Max) const;
+
+	UFUNCTION(BlueprintCallable, Category = "FC|POI")
+	TArray<AFCOverworldPOI*> FindNearestPOIs(FVector Center, int32 Count = 1, float MaxRadius = 0.f) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<AFCOverworldPOI> POI;
+		FVector2D Location = FVector2D::ZeroVector;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+
+		/** Next entry in the same bucket, or the next free entry once released */
+		int32 Next = INDEX_NONE;
+
+		bool bInUse = false;
+	};
+
+	/** Power of two; many more buckets than occupied cells keeps chains short */
+	static constexpr int32 NumBuckets = 4096;
+
+	/** Cell edge from the GameInstance overworld bounds (falls back to a 100 m cell) */
+	void ConfigureCellSize();
+
+	FIntPoint WorldToCell(const FVector2D& Location) const;
+	static int32 CellToBucket(const FIntPoint& Cell);
+
+	void LinkEntry(int32 EntryIndex);
+	void UnlinkEntry(int32 EntryIndex);
+
+	/** Visit the live entries in the cells MinCell..MaxCell (inclusive), clipped to the occupied bounds */
+	void ForEachInCells(const FIntPoint& MinCell, const FIntPoint& MaxCell, TFunctionRef<void(const FEntry& Entry)> Visit) const;
+
+	float CellSize = 0.f;
+	FVector2D GridOrigin = FVector2D::ZeroVector;
+
+	TArray<FEntry> Entries;
+	TArray<int32> BucketHeads;
+	int32 FreeHead = INDEX_NONE;
+
+	TMap<TObjectKey<AFCOverworldPOI>, int32> EntryByPOI;
+
+	/** Bounds of the occupied cells, so ring searches stop at the last POI */
+	FIntPoint OccupiedMin = FIntPoint::ZeroValue;
+	FIntPoint OccupiedMax = FIntPoint::ZeroValue;
+};
@@ -0,0 +1,221 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#include "WorldMap/FCMaskTextureUploader.h"
+
+#include "Engine/Texture2D.h"
+#include "Misc/ScopeLock.h"
+#include "WorldMap/FCWorldMapStats.h"
+
+/**
+ * Staging buffers shared with the render thread. The upload cleanup callback returns
+ * buffers here (from the render thread), so access is guarded and the pool itself is
+ * kept alive by every in-flight upload.
+ */
+struct FFCMaskTextureUploader::FBufferPool
+{
+	static constexpr int32 MaxPooledBuffers = 3;
+
+	FCriticalSection Lock;
+	TArray<uint8*, TInlineAllocator<MaxPooledBuffers>> FreeBuffers;
+	int32 BufferSize = 0;
+
+	~FBufferPool()
+	{
+		for (uint8* Buffer : FreeBuffers)
+		{
+			delete[] Buffer;
+		}
+	}
+
+	void SetBufferSize(int32 InBufferSize)
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (InBufferSize != BufferSize)
+		{
+			for (uint8* Buffer : FreeBuffers)
+			{
+				delete[] Buffer;
+			}
+			FreeBuffers.Reset();
+			BufferSize = InBufferSize;
+		}
+	}
+
+	uint8* Acquire()
+	{
+		FScopeLock ScopeLock(&Lock);
+		return FreeBuffers.Num() > 0 ? FreeBuffers.Pop(EAllowShrinking::No) : new uint8[BufferSize];
+	}
+
+	void Release(uint8* Buffer, int32 Size)
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (Size == BufferSize && FreeBuffers.Num() < MaxPooledBuffers)
+		{
+			FreeBuffers.Add(Buffer);
+		}
+		else
+		{
+			delete[] Buffer;
+		}
+	}
+};
+
+namespace
+{
+	/** True if the rects overlap or share an edge (Max is exclusive). */
+	bool AreRectsTouching(const FIntRect& A, const FIntRect& B)
+	{
+		return A.Min.X <= B.Max.X && B.Min.X <= A.Max.X
+			&& A.Min.Y <= B.Max.Y && B.Min.Y <= A.Max.Y;
+	}
+
+	FIntRect UnionOfRects(const FIntRect& A, const FIntRect& B)
+	{
+		FIntRect Result = A;
+		Result.Union(B);
+		return Result;
+	}
+}
+
+FFCMaskTextureUploader::FFCMaskTextureUploader()
+	: Pool(MakeShared<FBufferPool, ESPMode::ThreadSafe>())
+{
+}
+
+void FFCMaskTextureUploader::Init(UTexture2D* InTexture, int32 InWidth, int32 InHeight)
+{
+	Texture = InTexture;
+	Width = InWidth;
+	Height = InHeight;
+	DirtyRects.Reset();
+	bFullDirty = false;
+	Pool->SetBufferSize(Width * Height);
+}
+
+void FFCMaskTextureUploader::MarkAllDirty()
+{
+	bFullDirty = true;
+	DirtyRects.Reset();
+}
+
+void FFCMaskTextureUploader::MarkDirtyRect(const FIntRect& InRect)
+{
+	if (bFullDirty)
+	{
+		return;
+	}
+
+	FIntRect Rect(
+		FMath::Max(InRect.Min.X, 0), FMath::Max(InRect.Min.Y, 0),
+		FMath::Min(InRect.Max.X, Width), FMath::Min(InRect.Max.Y, Height));
+	if (Rect.Min.X >= Rect.Max.X || Rect.Min.Y >= Rect.Max.Y)
+	{
+		return;
+	}
+
+	// Absorb every rect the new one touches; repeat because the grown rect may reach more.
+	for (int32 Index = DirtyRects.Num() - 1; Index >= 0; --Index)
+	{
+		if (AreRectsTouching(DirtyRects[Index], Rect))
+		{
+			Rect.Union(DirtyRects[Index]);
+			DirtyRects.RemoveAtSwap(Index, EAllowShrinking::No);
+			Index = DirtyRects.Num();
+		}
+	}
+	DirtyRects.Add(Rect);
+
+	// Too many disjoint rects: merge the pair that wastes the fewest texels.
+	while (DirtyRects.Num() > MaxDirtyRects)
+	{
+		int32 BestA = 0;
+		int32 BestB = 1;
+		int32 BestWaste = MAX_int32;
+		for (int32 A = 0; A < DirtyRects.Num(); ++A)
+		{
+			for (int32 B = A + 1; B < DirtyRects.Num(); ++B)
+			{
+				const int32 Waste = UnionOfRects(DirtyRects[A], DirtyRects[B]).Area() - DirtyRects[A].Area() - DirtyRects[B].Area();
+				if (Waste < BestWaste)
+				{
+					BestWaste = Waste;
+					BestA = A;
+					BestB = B;
+				}
+			}
+		}
+
+		DirtyRects[BestA].Union(DirtyRects[BestB]);
+		DirtyRects.RemoveAtSwap(BestB, EAllowShrinking::No);
+	}
+
+	int32 DirtyArea = 0;
+	for (const FIntRect& Dirty : DirtyRects)
+	{
+		DirtyArea += Dirty.Area();
+	}
+
+	if (DirtyArea > FMath::FloorToInt(FullUploadFraction * Width * Height))
+	{
+		MarkAllDirty();
+	}
+}
+
+void FFCMaskTextureUploader::Flush(FWriteRectFunc WriteRect)
+{
+	if (!IsDirty())
+	{
+		return;
+	}
+
+	if (!Texture)
+	{
+		DirtyRects.Reset();
+		bFullDirty = false;
+		return;
+	}
+
+	if (bFullDirty)
+	{
+		DirtyRects.Reset();
+		DirtyRects.Add(FIntRect(0, 0, Width, Height));
+		INC_DWORD_STAT(STAT_FCWorldMap_TextureFullUploads);
+	}
+
+	// Staging buffer mirrors the texture layout, so every region reads from its own location.
+	const int32 BufferSize = Width * Height;
+	uint8* Buffer = Pool->Acquire();
+	FUpdateTextureRegion2D* Regions = new FUpdateTextureRegion2D[DirtyRects.Num()];
+
+	int32 BytesUploaded = 0;
+	for (int32 Index = 0; Index < DirtyRects.Num(); ++Index)
+	{
+		const FIntRect& Rect = DirtyRects[Index];
+		Regions[Index] = FUpdateTextureRegion2D(Rect.Min.X, Rect.Min.Y, Rect.Min.X, Rect.Min.Y, Rect.Width(), Rect.Height());
+		WriteRect(Rect, Buffer + Rect.Min.Y * Width + Rect.Min.X, Width);
+		BytesUploaded += Rect.Area();
+	}
+
+	INC_DWORD_STAT(STAT_FCWorldMap_TextureUploadCommands);
+	INC_DWORD_STAT_BY(STAT_FCWorldMap_TextureUploadRegions, DirtyRects.Num());
+	INC_DWORD_STAT_BY(STAT_FCWorldMap_TextureUploadBytes, BytesUploaded);
+
+	// UpdateTextureRegions is async: the render thread owns Buffer/Regions until the cleanup callback.
+	TSharedRef<FBufferPool, ESPMode::ThreadSafe> PoolRef = Pool;
+	Texture->UpdateTextureRegions(
+		0,
+		DirtyRects.Num(),
+		Regions,
+		Width,              // Src pitch (bytes per row)
+		sizeof(uint8),      // Src bytes per pixel
+		Buffer,
+		[PoolRef, BufferSize](uint8* InSrcData, const FUpdateTextureRegion2D* InRegions)
+		{
+			PoolRef->Release(InSrcData, BufferSize);
+			delete[] InRegions;
+		});
+
+	DirtyRects.Reset();
+	bFullDirty = false;
+}
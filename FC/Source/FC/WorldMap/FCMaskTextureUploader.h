@@ -0,0 +1,53 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UTexture2D;
+
+/**
+ * FFCMaskTextureUploader batches CPU-side changes to a single-channel (PF_G8) mask texture.
+ * - Changed cells are accumulated as a handful of dirty rectangles per frame
+ *   (touching/overlapping rects are merged; past MaxDirtyRects the cheapest merge wins).
+ * - Flush() issues ONE UpdateTextureRegions call with every dirty rect, or a single
+ *   full-texture region once the dirty area passes FullUploadFraction.
+ * - Staging buffers are pooled and handed back by the render thread when the upload completes.
+ */
+class FFCMaskTextureUploader
+{
+public:
+	/** Writes the texels of Rect into OutBytes at the given row pitch (bytes). */
+	using FWriteRectFunc = TFunctionRef<void(const FIntRect& Rect, uint8* OutBytes, int32 Pitch)>;
+
+	FFCMaskTextureUploader();
+
+	void Init(UTexture2D* InTexture, int32 InWidth, int32 InHeight);
+
+	void MarkDirtyCell(int32 X, int32 Y) { MarkDirtyRect(FIntRect(X, Y, X + 1, Y + 1)); }
+	void MarkDirtyRect(const FIntRect& Rect);
+	void MarkAllDirty();
+
+	bool IsDirty() const { return bFullDirty || DirtyRects.Num() > 0; }
+
+	/** Upload everything marked dirty since the last flush (no-op when clean). */
+	void Flush(FWriteRectFunc WriteRect);
+
+	/** Rects kept before merging starts trading accuracy for fewer regions */
+	static constexpr int32 MaxDirtyRects = 8;
+
+	/** Dirty fraction of the texture above which a single full upload is cheaper */
+	static constexpr float FullUploadFraction = 0.5f;
+
+private:
+	struct FBufferPool;
+
+	UTexture2D* Texture = nullptr;
+	int32 Width = 0;
+	int32 Height = 0;
+
+	TArray<FIntRect, TInlineAllocator<MaxDirtyRects + 1>> DirtyRects;
+	bool bFullDirty = false;
+
+	TSharedRef<FBufferPool, ESPMode::ThreadSafe> Pool;
+};
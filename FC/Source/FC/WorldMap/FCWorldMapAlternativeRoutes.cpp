@@ -0,0 +1,290 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#include "WorldMap/FCWorldMapAlternativeRoutes.h"
+
+#include "Algo/Reverse.h"
+#include "Misc/ScopeLock.h"
+#include "WorldMap/FCWorldMapExploration.h"
+
+#include "Logging/LogMacros.h"
+#include "Expedition/FCExpeditionManager.h" // for LogFCWorldMap declaration
+
+int32 FFCWorldMapAlternativeRoutes::Find(const FFCWorldMapExploration& Map, int32 StartGlobalId, int32 GoalGlobalId, const FSettings& Settings,
+	TArray<FFCWorldMapRouteOption>& OutRoutes, const FThreadSafeBool* CancelFlag)
+{
+	FScopeLock Lock(&Mutex);
+
+	OutRoutes.Reset();
+	LastNodesExpanded = 0;
+
+	if (!FFCWorldMapExploration::IsValidGlobalId(StartGlobalId) || !FFCWorldMapExploration::IsValidGlobalId(GoalGlobalId)
+		|| !Map.IsTraversable_Global(StartGlobalId, GoalGlobalId) || !Map.IsReachable_Global(StartGlobalId, GoalGlobalId))
+	{
+		return 0;
+	}
+
+	ResetBuffers();
+	BuildCostToGoal(Map, StartGlobalId, GoalGlobalId, Settings);
+	if (CostToGoal[StartGlobalId] == MAX_int32)
+	{
+		return 0;
+	}
+
+	const int32 NumRoutes = FMath::Max(1, Settings.NumRoutes);
+	const int32 MaxAttempts = NumRoutes * FMath::Max(1, Settings.MaxAttemptsPerRoute);
+
+	for (int32 Attempt = 0; Attempt < MaxAttempts && OutRoutes.Num() < NumRoutes; ++Attempt)
+	{
+		if (CancelFlag && *CancelFlag)
+		{
+			break;
+		}
+
+		if (!SearchPenalized(Map, StartGlobalId, GoalGlobalId, PathScratch))
+		{
+			break;
+		}
+
+		// Steps already used by an earlier candidate are exactly the penalised cells.
+		const int32 Steps = PathScratch.Num() - 1;
+		int32 SharedSteps = 0;
+		for (int32 Index = 1; Index < PathScratch.Num(); ++Index)
+		{
+			SharedSteps += Penalty[PathScratch[Index]] > 0 ? 1 : 0;
+		}
+		const float SharedFraction = Steps > 0 ? static_cast<float>(SharedSteps) / Steps : 1.f;
+		const bool bAccept = OutRoutes.Num() == 0 || SharedFraction <= Settings.MaxSharedFraction;
+
+		for (int32 Index = 1; Index < PathScratch.Num(); ++Index)
+		{
+			const int32 GlobalId = PathScratch[Index];
+			if (Penalty[GlobalId] == 0)
+			{
+				PenalizedCells.Add(GlobalId);
+			}
+			Penalty[GlobalId] += FMath::Max(1, FMath::RoundToInt(Map.GetStepCost_Global(GlobalId) * Settings.PenaltyFactor));
+		}
+
+		if (bAccept)
+		{
+			FFCWorldMapRouteOption& Option = OutRoutes.AddDefaulted_GetRef();
+			Option.RouteGlobalIds = PathScratch;
+			Option.Length = Steps;
+			Option.SharedFraction = OutRoutes.Num() == 1 ? 0.f : SharedFraction;
+			Map.ComputePathCosts(PathScratch, Option.MoneyCost, Option.RiskCost, Option.TimeCost);
+		}
+	}
+
+	UE_LOG(LogFCWorldMap, Verbose, TEXT("FFCWorldMapAlternativeRoutes: %d of %d routes from %d to %d (Expanded=%d)"),
+		OutRoutes.Num(), NumRoutes, StartGlobalId, GoalGlobalId, LastNodesExpanded);
+	return OutRoutes.Num();
+}
+
+void FFCWorldMapAlternativeRoutes::ResetBuffers()
+{
+	constexpr int32 GlobalCount = FFCWorldMapExploration::GlobalCount;
+	if (Stamp.Num() != GlobalCount)
+	{
+		Stamp.SetNumZeroed(GlobalCount);
+		CurrentStamp = 0;
+		GScore.SetNumUninitialized(GlobalCount);
+		CameFrom.SetNumUninitialized(GlobalCount);
+		CostToGoal.SetNumUninitialized(GlobalCount);
+		Penalty.SetNumZeroed(GlobalCount);
+		Open.Reserve(1024);
+	}
+
+	for (const int32 GlobalId : PenalizedCells)
+	{
+		Penalty[GlobalId] = 0;
+	}
+	PenalizedCells.Reset();
+}
+
+void FFCWorldMapAlternativeRoutes::NextStamp()
+{
+	if (++CurrentStamp == 0)
+	{
+		FMemory::Memzero(Stamp.GetData(), Stamp.Num() * sizeof(uint32));
+		CurrentStamp = 1;
+	}
+}
+
+void FFCWorldMapAlternativeRoutes::BuildCostToGoal(const FFCWorldMapExploration& Map, int32 StartGlobalId, int32 GoalGlobalId, const FSettings& Settings)
+{
+	auto OpenLess = [](const FOpenNode& A, const FOpenNode& B)
+	{
+		return A.FScore < B.FScore;
+	};
+
+	for (int32& Cost : CostToGoal)
+	{
+		Cost = MAX_int32;
+	}
+
+	Open.Reset();
+	CostToGoal[GoalGlobalId] = 0;
+	Open.HeapPush(FOpenNode{ GoalGlobalId, 0, 0 }, OpenLess);
+
+	// Set once the start is settled: no route the rerouting searches accept costs much more than this.
+	int32 SearchBound = MAX_int32;
+	CostToGoalFloor = MAX_int32;
+
+	// Dijkstra on the reversed graph: stepping from a neighbour into Current costs Current's step cost.
+	while (Open.Num() > 0)
+	{
+		FOpenNode Current;
+		Open.HeapPop(Current, OpenLess, EAllowShrinking::No);
+		if (Current.GScore > CostToGoal[Current.GlobalId])
+		{
+			continue;
+		}
+
+		// Past the bound: everything still queued is unsettled, and costs at least Current.GScore.
+		if (Current.GScore > SearchBound)
+		{
+			CostToGoalFloor = Current.GScore;
+			CostToGoal[Current.GlobalId] = MAX_int32;
+			for (const FOpenNode& Pending : Open)
+			{
+				if (Pending.GScore == CostToGoal[Pending.GlobalId])
+				{
+					CostToGoal[Pending.GlobalId] = MAX_int32;
+				}
+			}
+			break;
+		}
+		++LastNodesExpanded;
+
+		if (Current.GlobalId == StartGlobalId)
+		{
+			const double Scale = 1.0 + FMath::Max(0.f, Settings.PenaltyFactor) * FMath::Max(1, Settings.NumRoutes);
+			SearchBound = static_cast<int32>(FMath::Min<double>(Current.GScore * Scale, MAX_int32 - 1));
+		}
+
+		const int32 EnterCost = Current.GScore + Map.GetStepCost_Global(Current.GlobalId);
+
+		int32 X, Y;
+		FFCWorldMapExploration::GlobalIdToXY(Current.GlobalId, X, Y);
+
+		const int32 NeighborX[4] = { X + 1, X - 1, X,     X };
+		const int32 NeighborY[4] = { Y,     Y,     Y + 1, Y - 1 };
+
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			if (!FFCWorldMapExploration::IsValidGlobal(NeighborX[Index], NeighborY[Index]))
+			{
+				continue;
+			}
+
+			const int32 NeighborId = FFCWorldMapExploration::XYToGlobalId(NeighborX[Index], NeighborY[Index]);
+			if (EnterCost >= CostToGoal[NeighborId] || !Map.IsTraversable_Global(NeighborId, GoalGlobalId))
+			{
+				continue;
+			}
+
+			CostToGoal[NeighborId] = EnterCost;
+			Open.HeapPush(FOpenNode{ NeighborId, EnterCost, EnterCost }, OpenLess);
+		}
+	}
+}
+
+bool FFCWorldMapAlternativeRoutes::SearchPenalized(const FFCWorldMapExploration& Map, int32 StartGlobalId, int32 GoalGlobalId, TArray<int32>& OutPath)
+{
+	// Lowest F first; on ties prefer the deeper node (same order as FindCheapestPath_AStar).
+	auto OpenLess = [](const FOpenNode& A, const FOpenNode& B)
+	{
+		return A.FScore < B.FScore || (A.FScore == B.FScore && A.GScore > B.GScore);
+	};
+
+	OutPath.Reset();
+	NextStamp();
+	Open.Reset();
+
+	int32 GoalX, GoalY;
+	FFCWorldMapExploration::GlobalIdToXY(GoalGlobalId, GoalX, GoalY);
+	const int32 MinStepCost = Map.GetMinStepCost();
+
+	Stamp[StartGlobalId] = CurrentStamp;
+	GScore[StartGlobalId] = 0;
+	CameFrom[StartGlobalId] = StartGlobalId;
+	Open.HeapPush(FOpenNode{ StartGlobalId, 0, CostToGoal[StartGlobalId] }, OpenLess);
+
+	bool bFound = false;
+	while (Open.Num() > 0)
+	{
+		FOpenNode Current;
+		Open.HeapPop(Current, OpenLess, EAllowShrinking::No);
+
+		// Stale heap entry: a cheaper route to this cell was already expanded.
+		if (Current.GScore > GScore[Current.GlobalId])
+		{
+			continue;
+		}
+		++LastNodesExpanded;
+
+		if (Current.GlobalId == GoalGlobalId)
+		{
+			bFound = true;
+			break;
+		}
+
+		int32 X, Y;
+		FFCWorldMapExploration::GlobalIdToXY(Current.GlobalId, X, Y);
+
+		const int32 NeighborX[4] = { X + 1, X - 1, X,     X };
+		const int32 NeighborY[4] = { Y,     Y,     Y + 1, Y - 1 };
+
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			if (!FFCWorldMapExploration::IsValidGlobal(NeighborX[Index], NeighborY[Index]))
+			{
+				continue;
+			}
+
+			const int32 NeighborId = FFCWorldMapExploration::XYToGlobalId(NeighborX[Index], NeighborY[Index]);
+			if (!Map.IsTraversable_Global(NeighborId, GoalGlobalId))
+			{
+				continue;
+			}
+
+			int32 Remaining = CostToGoal[NeighborId];
+			if (Remaining == MAX_int32)
+			{
+				// A complete backward pass leaves only cells that cannot reach the goal; never enter them.
+				if (CostToGoalFloor == MAX_int32)
+				{
+					continue;
+				}
+
+				// Cut off by the bound: the Manhattan heuristic, raised to the floor every unsettled cell costs.
+				const int32 Manhattan = FMath::Abs(NeighborX[Index] - GoalX) + FMath::Abs(NeighborY[Index] - GoalY);
+				Remaining = FMath::Max(CostToGoalFloor, Manhattan * MinStepCost);
+			}
+
+			const int32 TentativeG = Current.GScore + Map.GetStepCost_Global(NeighborId) + Penalty[NeighborId];
+			if (Stamp[NeighborId] == CurrentStamp && TentativeG >= GScore[NeighborId])
+			{
+				continue;
+			}
+
+			Stamp[NeighborId] = CurrentStamp;
+			GScore[NeighborId] = TentativeG;
+			CameFrom[NeighborId] = Current.GlobalId;
+			Open.HeapPush(FOpenNode{ NeighborId, TentativeG, TentativeG + Remaining }, OpenLess);
+		}
+	}
+
+	if (!bFound)
+	{
+		return false;
+	}
+
+	for (int32 Node = GoalGlobalId; Node != StartGlobalId; Node = CameFrom[Node])
+	{
+		OutPath.Add(Node);
+	}
+	OutPath.Add(StartGlobalId);
+	Algo::Reverse(OutPath);
+	return true;
+}
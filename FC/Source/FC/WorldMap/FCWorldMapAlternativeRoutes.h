@@ -0,0 +1,123 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/ThreadSafeBool.h"
+#include "FCWorldMapAlternativeRoutes.generated.h"
+
+class FFCWorldMapExploration;
+
+/** One candidate route for the planning table, with its cost breakdown */
+USTRUCT(BlueprintType)
+struct FC_API FFCWorldMapRouteOption
+{
+	GENERATED_BODY()
+
+	/** Start to goal, start cell included */
+	UPROPERTY(BlueprintReadOnly, Category = "FC|WorldMap|Planning")
+	TArray<int32> RouteGlobalIds;
+
+	UPROPERTY(BlueprintReadOnly, Category = "FC|WorldMap|Planning")
+	int32 MoneyCost = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "FC|WorldMap|Planning")
+	int32 RiskCost = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "FC|WorldMap|Planning")
+	int32 TimeCost = 0;
+
+	/** Steps (cells entered) */
+	UPROPERTY(BlueprintReadOnly, Category = "FC|WorldMap|Planning")
+	int32 Length = 0;
+
+	/** Fraction of the steps shared with the routes listed before it (0 for the first) */
+	UPROPERTY(BlueprintReadOnly, Category = "FC|WorldMap|Planning")
+	float SharedFraction = 0.f;
+};
+
+/**
+ * FFCWorldMapAlternativeRoutes finds up to k cheap, mutually different routes by penalty rerouting.
+ * - The first route is the cheapest (money + risk). After each route its cells get more
+ *   expensive, and the next A* search runs against the penalised costs.
+ * - Routes sharing more than MaxSharedFraction of their steps with earlier routes are dropped
+ *   (their cells are still penalised, so the next attempt moves further away).
+ * - One backward Dijkstra from the goal gives exact remaining unpenalised costs. Penalties only
+ *   add cost, so that stays an admissible heuristic, and each rerouting search expands little
+ *   more than the corridor it ends up in. The pass stops once it is past the start's cost times
+ *   (1 + PenaltyFactor * NumRoutes); cells it did not settle fall back to Manhattan distance,
+ *   raised to the cost it stopped at.
+ * - All buffers persist between calls and are reset through generation stamps, not refills.
+ *
+ * Not thread-safe per instance: Find() locks, so concurrent callers queue up.
+ */
+class FC_API FFCWorldMapAlternativeRoutes
+{
+public:
+	struct FSettings
+	{
+		int32 NumRoutes = 5;
+
+		/** Extra cost per earlier route using a cell, as a fraction of the cell's step cost */
+		float PenaltyFactor = 0.6f;
+
+		/** Candidates sharing more of their steps with earlier routes are dropped */
+		float MaxSharedFraction = 0.75f;
+
+		/** Searches allowed per requested route, including the dropped ones */
+		int32 MaxAttemptsPerRoute = 3;
+	};
+
+	/**
+	 * Fill OutRoutes with up to Settings.NumRoutes routes, cheapest first.
+	 * Same traversal rules as the other planners. Returns the number of routes found;
+	 * stops early (keeping what it has) once CancelFlag is set. Map must not change during the call.
+	 */
+	int32 Find(const FFCWorldMapExploration& Map, int32 StartGlobalId, int32 GoalGlobalId, const FSettings& Settings,
+		TArray<FFCWorldMapRouteOption>& OutRoutes, const FThreadSafeBool* CancelFlag = nullptr);
+
+	/** Cells expanded by the last Find (backward pass included), for profiling */
+	int32 GetLastNodesExpanded() const { return LastNodesExpanded; }
+
+private:
+	struct FOpenNode
+	{
+		int32 GlobalId;
+		int32 GScore;
+		int32 FScore;
+	};
+
+	void ResetBuffers();
+	void NextStamp();
+
+	/** Exact unpenalised cost to the goal, into CostToGoal, for every cell within the search bound */
+	void BuildCostToGoal(const FFCWorldMapExploration& Map, int32 StartGlobalId, int32 GoalGlobalId, const FSettings& Settings);
+
+	/** A* over penalised step costs with CostToGoal as the heuristic */
+	bool SearchPenalized(const FFCWorldMapExploration& Map, int32 StartGlobalId, int32 GoalGlobalId, TArray<int32>& OutPath);
+
+	FCriticalSection Mutex;
+
+	/** Cell values are valid only when Stamp[Cell] == CurrentStamp */
+	TArray<uint32> Stamp;
+	uint32 CurrentStamp = 0;
+
+	TArray<int32> GScore;
+	TArray<int32> CameFrom;
+	TArray<FOpenNode> Open;
+
+	/** Valid for every cell (MAX_int32 = not settled: cannot reach the goal, or past the search bound) */
+	TArray<int32> CostToGoal;
+
+	/** Lower bound on the cost of every unsettled cell; MAX_int32 if the backward pass ran to completion */
+	int32 CostToGoalFloor = MAX_int32;
+
+	/** Extra step cost per cell from earlier routes; only PenalizedCells are non-zero */
+	TArray<int32> Penalty;
+	TArray<int32> PenalizedCells;
+
+	TArray<int32> PathScratch;
+
+	int32 LastNodesExpanded = 0;
+};
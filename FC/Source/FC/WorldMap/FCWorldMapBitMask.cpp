@@ -0,0 +1,307 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#include "WorldMap/FCWorldMapBitMask.h"
+
+#include "Misc/Crc.h"
+
+void FFCWorldMapBitMask::Init(int32 InWidth, int32 InHeight, bool bValue)
+{
+	check(InWidth >= 0 && InHeight >= 0);
+
+	Width = InWidth;
+	Height = InHeight;
+	WordsPerRow = (Width + BitsPerWord - 1) / BitsPerWord;
+	bRowsPacked = (Width % BitsPerWord) == 0;
+	Words.SetNumUninitialized(WordsPerRow * Height);
+	SetAll(bValue);
+}
+
+void FFCWorldMapBitMask::SetAll(bool bValue)
+{
+	if (!bValue)
+	{
+		FMemory::Memzero(Words.GetData(), Words.Num() * sizeof(uint64));
+		return;
+	}
+
+	if (WordsPerRow == 0)
+	{
+		return;
+	}
+
+	const uint64 LastWordMask = GetLastWordMask();
+	for (int32 Y = 0; Y < Height; ++Y)
+	{
+		uint64* Row = Words.GetData() + Y * WordsPerRow;
+		for (int32 W = 0; W < WordsPerRow; ++W)
+		{
+			Row[W] = ~0ull;
+		}
+		Row[WordsPerRow - 1] = LastWordMask;
+	}
+}
+
+uint64 FFCWorldMapBitMask::GetLastWordMask() const
+{
+	const int32 TailBits = Width % BitsPerWord;
+	return TailBits == 0 ? ~0ull : ((1ull << TailBits) - 1ull);
+}
+
+int32 FFCWorldMapBitMask::CountRow(int32 Y) const
+{
+	check(Y >= 0 && Y < Height);
+
+	int32 Count = 0;
+	const uint64* Row = Words.GetData() + Y * WordsPerRow;
+	for (int32 W = 0; W < WordsPerRow; ++W)
+	{
+		Count += static_cast<int32>(FMath::CountBits(Row[W]));
+	}
+	return Count;
+}
+
+int32 FFCWorldMapBitMask::CountAll() const
+{
+	int32 Count = 0;
+	for (const uint64 Word : Words)
+	{
+		Count += static_cast<int32>(FMath::CountBits(Word));
+	}
+	return Count;
+}
+
+template <typename FunctorType>
+bool FFCWorldMapBitMask::VisitRectWords(const FIntRect& Rect, FunctorType&& Visitor) const
+{
+	const int32 MinX = FMath::Max(Rect.Min.X, 0);
+	const int32 MinY = FMath::Max(Rect.Min.Y, 0);
+	const int32 MaxX = FMath::Min(Rect.Max.X, Width);
+	const int32 MaxY = FMath::Min(Rect.Max.Y, Height);
+	if (MinX >= MaxX || MinY >= MaxY)
+	{
+		return false;
+	}
+
+	// Build the per-word column masks once, then walk each row a word at a time.
+	const int32 FirstWord = MinX / BitsPerWord;
+	const int32 LastWord = (MaxX - 1) / BitsPerWord;
+	const uint64 FirstMask = ~0ull << (MinX % BitsPerWord);
+	const int32 LastBits = ((MaxX - 1) % BitsPerWord) + 1;
+	const uint64 LastMask = LastBits == BitsPerWord ? ~0ull : ((1ull << LastBits) - 1ull);
+
+	for (int32 Y = MinY; Y < MaxY; ++Y)
+	{
+		const uint64* Row = Words.GetData() + Y * WordsPerRow;
+		for (int32 W = FirstWord; W <= LastWord; ++W)
+		{
+			uint64 ColumnMask = ~0ull;
+			if (W == FirstWord)
+			{
+				ColumnMask &= FirstMask;
+			}
+			if (W == LastWord)
+			{
+				ColumnMask &= LastMask;
+			}
+
+			if (!Visitor(Row[W], ColumnMask))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool FFCWorldMapBitMask::AnyInRect(const FIntRect& Rect) const
+{
+	bool bAny = false;
+	VisitRectWords(Rect, [&bAny](uint64 Word, uint64 ColumnMask)
+	{
+		bAny = (Word & ColumnMask) != 0;
+		return !bAny;
+	});
+	return bAny;
+}
+
+bool FFCWorldMapBitMask::AllInRect(const FIntRect& Rect) const
+{
+	return VisitRectWords(Rect, [](uint64 Word, uint64 ColumnMask)
+	{
+		return (Word & ColumnMask) == ColumnMask;
+	});
+}
+
+void FFCWorldMapBitMask::And(const FFCWorldMapBitMask& Other)
+{
+	check(Width == Other.Width && Height == Other.Height);
+	for (int32 W = 0; W < Words.Num(); ++W)
+	{
+		Words[W] &= Other.Words[W];
+	}
+}
+
+void FFCWorldMapBitMask::Or(const FFCWorldMapBitMask& Other)
+{
+	check(Width == Other.Width && Height == Other.Height);
+	for (int32 W = 0; W < Words.Num(); ++W)
+	{
+		Words[W] |= Other.Words[W];
+	}
+}
+
+void FFCWorldMapBitMask::AndNot(const FFCWorldMapBitMask& Other)
+{
+	check(Width == Other.Width && Height == Other.Height);
+	for (int32 W = 0; W < Words.Num(); ++W)
+	{
+		Words[W] &= ~Other.Words[W];
+	}
+}
+
+void FFCWorldMapBitMask::Invert()
+{
+	if (WordsPerRow == 0)
+	{
+		return;
+	}
+
+	const uint64 LastWordMask = GetLastWordMask();
+	for (int32 Y = 0; Y < Height; ++Y)
+	{
+		uint64* Row = Words.GetData() + Y * WordsPerRow;
+		for (int32 W = 0; W < WordsPerRow; ++W)
+		{
+			Row[W] = ~Row[W];
+		}
+		Row[WordsPerRow - 1] &= LastWordMask;
+	}
+}
+
+void FFCWorldMapBitMask::Dilate4()
+{
+	if (WordsPerRow == 0)
+	{
+		return;
+	}
+
+	const TArray<uint64> Source = Words;
+	const uint64 LastWordMask = GetLastWordMask();
+
+	for (int32 Y = 0; Y < Height; ++Y)
+	{
+		const uint64* Src = Source.GetData() + Y * WordsPerRow;
+		const uint64* SrcUp = Y > 0 ? Src - WordsPerRow : nullptr;
+		const uint64* SrcDown = Y < Height - 1 ? Src + WordsPerRow : nullptr;
+		uint64* Dst = Words.GetData() + Y * WordsPerRow;
+
+		for (int32 W = 0; W < WordsPerRow; ++W)
+		{
+			const uint64 Prev = W > 0 ? Src[W - 1] : 0;
+			const uint64 Next = W < WordsPerRow - 1 ? Src[W + 1] : 0;
+
+			// Bit X picks up X-1 (shift towards higher bits) and X+1 (shift towards lower bits).
+			uint64 Grown = Src[W] | (Src[W] << 1) | (Prev >> (BitsPerWord - 1)) | (Src[W] >> 1) | (Next << (BitsPerWord - 1));
+			if (SrcUp)
+			{
+				Grown |= SrcUp[W];
+			}
+			if (SrcDown)
+			{
+				Grown |= SrcDown[W];
+			}
+			Dst[W] = Grown;
+		}
+		Dst[WordsPerRow - 1] &= LastWordMask;
+	}
+}
+
+void FFCWorldMapBitMask::ExpandToBytes(TArray<uint8>& OutBytes, uint8 OnValue, uint8 OffValue) const
+{
+	OutBytes.SetNumUninitialized(Num());
+	ExpandRectToBytes(FIntRect(0, 0, Width, Height), OutBytes.GetData(), 0, OnValue, OffValue);
+}
+
+void FFCWorldMapBitMask::ExpandRectToBytes(const FIntRect& Rect, uint8* OutBytes, int32 OutPitch, uint8 OnValue, uint8 OffValue) const
+{
+	check(Rect.Min.X >= 0 && Rect.Min.Y >= 0 && Rect.Max.X <= Width && Rect.Max.Y <= Height);
+
+	const int32 Pitch = OutPitch > 0 ? OutPitch : Rect.Width();
+	for (int32 Y = Rect.Min.Y; Y < Rect.Max.Y; ++Y)
+	{
+		const uint64* Row = Words.GetData() + Y * WordsPerRow;
+		uint8* Out = OutBytes + (Y - Rect.Min.Y) * Pitch;
+		for (int32 X = Rect.Min.X; X < Rect.Max.X; ++X)
+		{
+			const bool bSet = ((Row[X / BitsPerWord] >> (X % BitsPerWord)) & 1ull) != 0;
+			*Out++ = bSet ? OnValue : OffValue;
+		}
+	}
+}
+
+void FFCWorldMapBitMask::FromBytes(const TArray<uint8>& Bytes, uint8 Threshold)
+{
+	check(Bytes.Num() == Num());
+
+	for (int32 Y = 0; Y < Height; ++Y)
+	{
+		uint64* Row = Words.GetData() + Y * WordsPerRow;
+		const uint8* Src = Bytes.GetData() + Y * Width;
+		for (int32 W = 0; W < WordsPerRow; ++W)
+		{
+			const int32 XBase = W * BitsPerWord;
+			const int32 Count = FMath::Min(BitsPerWord, Width - XBase);
+
+			uint64 Word = 0;
+			for (int32 Bit = 0; Bit < Count; ++Bit)
+			{
+				Word |= static_cast<uint64>(Src[XBase + Bit] >= Threshold) << Bit;
+			}
+			Row[W] = Word;
+		}
+	}
+}
+
+bool FFCWorldMapBitMask::FromWords(const TArray<uint64>& InWords)
+{
+	if (InWords.Num() != Words.Num())
+	{
+		return false;
+	}
+
+	Words = InWords;
+
+	// Never trust padding bits from outside: word-level counts rely on them being clear.
+	if (!bRowsPacked)
+	{
+		const uint64 LastWordMask = GetLastWordMask();
+		for (int32 Y = 0; Y < Height; ++Y)
+		{
+			Words[Y * WordsPerRow + WordsPerRow - 1] &= LastWordMask;
+		}
+	}
+	return true;
+}
+
+uint32 FFCWorldMapBitMask::GetHash() const
+{
+	return FCrc::MemCrc32(Words.GetData(), Words.Num() * sizeof(uint64));
+}
+
+uint64 FFCWorldMapBitMask::GetRowBits(int32 X, int32 Y, int32 Count) const
+{
+	check(Count > 0 && Count <= BitsPerWord && (X % BitsPerWord) + Count <= BitsPerWord);
+
+	const uint64 Word = Words[Y * WordsPerRow + X / BitsPerWord] >> (X % BitsPerWord);
+	return Count == BitsPerWord ? Word : Word & ((1ull << Count) - 1);
+}
+
+void FFCWorldMapBitMask::SetRowBits(int32 X, int32 Y, int32 Count, uint64 Bits)
+{
+	check(Count > 0 && Count <= BitsPerWord && (X % BitsPerWord) + Count <= BitsPerWord && X + Count <= Width);
+
+	const uint64 SpanMask = (Count == BitsPerWord ? ~0ull : (1ull << Count) - 1) << (X % BitsPerWord);
+	uint64& Word = Words[Y * WordsPerRow + X / BitsPerWord];
+	Word = (Word & ~SpanMask) | ((Bits << (X % BitsPerWord)) & SpanMask);
+}
@@ -0,0 +1,162 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * FFCWorldMapBitMask is a 2D boolean mask packed into 64-bit words.
+ * - One bit per cell, rows padded to a whole number of words (256 wide = 4 words per row).
+ * - A 256x256 mask is 8 KB instead of the 64 KB byte-per-cell layout.
+ * - Bulk operations (AND/OR/ANDNOT, popcount, rect queries) work a word at a time.
+ * - Padding bits past Width are always kept clear so word-level counts stay exact.
+ */
+class FFCWorldMapBitMask
+{
+public:
+	static constexpr int32 BitsPerWord = 64;
+
+	FFCWorldMapBitMask() = default;
+	FFCWorldMapBitMask(int32 InWidth, int32 InHeight, bool bValue = false) { Init(InWidth, InHeight, bValue); }
+
+	/** Resize to InWidth x InHeight and fill every cell with bValue. */
+	void Init(int32 InWidth, int32 InHeight, bool bValue);
+
+	/** Fill every cell with bValue (dimensions unchanged). */
+	void SetAll(bool bValue);
+
+	int32 GetWidth() const { return Width; }
+	int32 GetHeight() const { return Height; }
+	int32 Num() const { return Width * Height; }
+	int32 GetWordsPerRow() const { return WordsPerRow; }
+
+	bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < Num(); }
+
+	// --- Per-cell access (Index = X + Y * Width) -------------------------------
+
+	FORCEINLINE bool Get(int32 Index) const
+	{
+		if (bRowsPacked)
+		{
+			return ((Words[Index / BitsPerWord] >> (Index % BitsPerWord)) & 1ull) != 0;
+		}
+		return GetXY(Index % Width, Index / Width);
+	}
+
+	FORCEINLINE bool GetXY(int32 X, int32 Y) const
+	{
+		const uint64 Word = Words[Y * WordsPerRow + (X / BitsPerWord)];
+		return ((Word >> (X % BitsPerWord)) & 1ull) != 0;
+	}
+
+	/** Returns true if the stored value changed. */
+	FORCEINLINE bool Set(int32 Index, bool bValue)
+	{
+		const int32 X = bRowsPacked ? Index : Index % Width;
+		const int32 Y = bRowsPacked ? 0 : Index / Width;
+		uint64& Word = Words[Y * WordsPerRow + (X / BitsPerWord)];
+		const uint64 Bit = 1ull << (X % BitsPerWord);
+		const uint64 NewWord = bValue ? (Word | Bit) : (Word & ~Bit);
+		const bool bChanged = NewWord != Word;
+		Word = NewWord;
+		return bChanged;
+	}
+
+	// --- Word-parallel queries -------------------------------------------------
+
+	/** Number of set cells in row Y. */
+	int32 CountRow(int32 Y) const;
+
+	/** Number of set cells in the whole mask. */
+	int32 CountAll() const;
+
+	/** True if any cell inside Rect (Min inclusive, Max exclusive, clamped to the mask) is set. */
+	bool AnyInRect(const FIntRect& Rect) const;
+
+	/** True if every cell inside Rect (clamped to the mask) is set; false for an empty rect. */
+	bool AllInRect(const FIntRect& Rect) const;
+
+	// --- Word-parallel combination (masks must share dimensions) ---------------
+
+	void And(const FFCWorldMapBitMask& Other);
+	void Or(const FFCWorldMapBitMask& Other);
+
+	/** this &= ~Other */
+	void AndNot(const FFCWorldMapBitMask& Other);
+
+	/** this = ~this (padding bits stay clear) */
+	void Invert();
+
+	/** Grow every set cell into its 4-neighbourhood (one step). */
+	void Dilate4();
+
+	/** Calls Visitor(Index) for every cell that differs between this and Other. */
+	template <typename FunctorType>
+	void ForEachDifference(const FFCWorldMapBitMask& Other, FunctorType&& Visitor) const
+	{
+		check(Width == Other.Width && Height == Other.Height);
+		for (int32 WordIndex = 0; WordIndex < Words.Num(); ++WordIndex)
+		{
+			uint64 Diff = Words[WordIndex] ^ Other.Words[WordIndex];
+			const int32 Y = WordIndex / WordsPerRow;
+			const int32 XBase = (WordIndex % WordsPerRow) * BitsPerWord;
+			while (Diff != 0)
+			{
+				const int32 Bit = static_cast<int32>(FMath::CountTrailingZeros64(Diff));
+				Visitor(XBase + Bit + Y * Width);
+				Diff &= Diff - 1;
+			}
+		}
+	}
+
+	bool operator==(const FFCWorldMapBitMask& Other) const
+	{
+		return Width == Other.Width && Height == Other.Height && Words == Other.Words;
+	}
+	bool operator!=(const FFCWorldMapBitMask& Other) const { return !(*this == Other); }
+
+	// --- Byte conversion (texture upload / legacy save data) -------------------
+
+	/** Expand to one byte per cell (row-major, no padding): OnValue where set, OffValue elsewhere. */
+	void ExpandToBytes(TArray<uint8>& OutBytes, uint8 OnValue, uint8 OffValue = 0) const;
+
+	/** Expand only Rect into OutBytes, advancing OutPitch bytes per row (0 = tightly packed). */
+	void ExpandRectToBytes(const FIntRect& Rect, uint8* OutBytes, int32 OutPitch, uint8 OnValue, uint8 OffValue = 0) const;
+
+	/** Pack one byte per cell; a cell is set when its byte is >= Threshold. Bytes.Num() must equal Num(). */
+	void FromBytes(const TArray<uint8>& Bytes, uint8 Threshold);
+
+	// --- Packed word access (save data) ----------------------------------------
+
+	const TArray<uint64>& GetWords() const { return Words; }
+
+	/** Replace the packed words (same layout as GetWords()); returns false on a size mismatch. */
+	bool FromWords(const TArray<uint64>& InWords);
+
+	/** CRC of the packed words; equal masks of equal size always hash equal. */
+	uint32 GetHash() const;
+
+	/** Count (<= 64) bits of row Y starting at X, low bit first. The span must not cross a word. */
+	uint64 GetRowBits(int32 X, int32 Y, int32 Count) const;
+	void SetRowBits(int32 X, int32 Y, int32 Count, uint64 Bits);
+
+private:
+	/** Mask of the valid bits in the last word of each row. */
+	uint64 GetLastWordMask() const;
+
+	/**
+	 * Visit each word covered by Rect with the column mask of the covered bits.
+	 * Visitor(Word, ColumnMask) returns false to stop; returns false if stopped, or if Rect is empty.
+	 */
+	template <typename FunctorType>
+	bool VisitRectWords(const FIntRect& Rect, FunctorType&& Visitor) const;
+
+	int32 Width = 0;
+	int32 Height = 0;
+	int32 WordsPerRow = 0;
+
+	/** Width is a multiple of BitsPerWord, so a flat index maps straight to a word (no row padding). */
+	bool bRowsPacked = true;
+
+	TArray<uint64> Words;
+};
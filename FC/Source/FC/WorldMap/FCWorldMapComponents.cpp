@@ -0,0 +1,128 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#include "WorldMap/FCWorldMapComponents.h"
+
+#include "WorldMap/FCWorldMapBitMask.h"
+
+void FFCWorldMapComponents::Rebuild(const FFCWorldMapBitMask& Traversable)
+{
+	Width = Traversable.GetWidth();
+	const int32 Height = Traversable.GetHeight();
+	const int32 Count = Traversable.Num();
+
+	Parent.SetNumUninitialized(Count);
+	Size.SetNumUninitialized(Count);
+	NumComponents = 0;
+
+	// Scanline: each traversable cell starts as its own root, then joins its west and north neighbours.
+	for (int32 Y = 0; Y < Height; ++Y)
+	{
+		for (int32 X = 0; X < Width; ++X)
+		{
+			const int32 Id = X + Y * Width;
+			if (!Traversable.GetXY(X, Y))
+			{
+				Parent[Id] = INDEX_NONE;
+				continue;
+			}
+
+			Parent[Id] = Id;
+			Size[Id] = 1;
+			++NumComponents;
+
+			if (X > 0 && Parent[Id - 1] != INDEX_NONE)
+			{
+				Union(Id, Id - 1);
+			}
+			if (Y > 0 && Parent[Id - Width] != INDEX_NONE)
+			{
+				Union(Id, Id - Width);
+			}
+		}
+	}
+}
+
+void FFCWorldMapComponents::AddCell(const FFCWorldMapBitMask& Traversable, int32 GlobalId)
+{
+	if (!Parent.IsValidIndex(GlobalId) || Parent[GlobalId] != INDEX_NONE)
+	{
+		return;
+	}
+
+	Parent[GlobalId] = GlobalId;
+	Size[GlobalId] = 1;
+	++NumComponents;
+
+	const int32 X = GlobalId % Width;
+	const int32 Y = GlobalId / Width;
+	const int32 Height = Parent.Num() / Width;
+
+	if (X > 0 && Traversable.Get(GlobalId - 1))
+	{
+		Union(GlobalId, GlobalId - 1);
+	}
+	if (X < Width - 1 && Traversable.Get(GlobalId + 1))
+	{
+		Union(GlobalId, GlobalId + 1);
+	}
+	if (Y > 0 && Traversable.Get(GlobalId - Width))
+	{
+		Union(GlobalId, GlobalId - Width);
+	}
+	if (Y < Height - 1 && Traversable.Get(GlobalId + Width))
+	{
+		Union(GlobalId, GlobalId + Width);
+	}
+}
+
+int32 FFCWorldMapComponents::GetComponent(int32 GlobalId) const
+{
+	if (!Parent.IsValidIndex(GlobalId) || Parent[GlobalId] == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	// Union by size keeps trees O(log N) deep, so an uncompressed walk is cheap.
+	int32 Root = GlobalId;
+	while (Parent[Root] != Root)
+	{
+		Root = Parent[Root];
+	}
+	return Root;
+}
+
+bool FFCWorldMapComponents::AreConnected(int32 GlobalIdA, int32 GlobalIdB) const
+{
+	const int32 RootA = GetComponent(GlobalIdA);
+	return RootA != INDEX_NONE && RootA == GetComponent(GlobalIdB);
+}
+
+int32 FFCWorldMapComponents::FindRootAndCompress(int32 GlobalId)
+{
+	int32 Node = GlobalId;
+	while (Parent[Node] != Node)
+	{
+		Parent[Node] = Parent[Parent[Node]]; // path halving
+		Node = Parent[Node];
+	}
+	return Node;
+}
+
+void FFCWorldMapComponents::Union(int32 GlobalIdA, int32 GlobalIdB)
+{
+	int32 RootA = FindRootAndCompress(GlobalIdA);
+	int32 RootB = FindRootAndCompress(GlobalIdB);
+	if (RootA == RootB)
+	{
+		return;
+	}
+
+	if (Size[RootA] < Size[RootB])
+	{
+		Swap(RootA, RootB);
+	}
+
+	Parent[RootB] = RootA;
+	Size[RootA] += Size[RootB];
+	--NumComponents;
+}
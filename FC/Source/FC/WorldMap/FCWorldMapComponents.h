@@ -0,0 +1,46 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FFCWorldMapBitMask;
+
+/**
+ * FFCWorldMapComponents labels the 4-connected components of the traversable cells.
+ * - Union-find (union by size, path halving) over global cell ids.
+ * - Cells that become traversable are merged into their neighbours incrementally.
+ * - Cells that stop being traversable cannot be split out, so callers rebuild instead (rare).
+ * - Queries never mutate, so const planners can reject unreachable goals up front.
+ */
+class FFCWorldMapComponents
+{
+public:
+	/** Relabel every traversable cell from scratch (single scanline pass). */
+	void Rebuild(const FFCWorldMapBitMask& Traversable);
+
+	/** GlobalId just became traversable in Traversable: link it to its traversable neighbours. */
+	void AddCell(const FFCWorldMapBitMask& Traversable, int32 GlobalId);
+
+	/** Component id for a traversable cell, INDEX_NONE otherwise. */
+	int32 GetComponent(int32 GlobalId) const;
+
+	/** True if both cells are traversable and share a component. */
+	bool AreConnected(int32 GlobalIdA, int32 GlobalIdB) const;
+
+	/** Number of distinct components (for diagnostics). */
+	int32 GetNumComponents() const { return NumComponents; }
+
+private:
+	int32 FindRootAndCompress(int32 GlobalId);
+	void Union(int32 GlobalIdA, int32 GlobalIdB);
+
+	/** Parent per cell; INDEX_NONE for non-traversable cells, self for roots. */
+	TArray<int32> Parent;
+
+	/** Component size, valid for roots only. */
+	TArray<int32> Size;
+
+	int32 Width = 0;
+	int32 NumComponents = 0;
+};
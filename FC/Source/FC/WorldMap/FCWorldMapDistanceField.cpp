@@ -0,0 +1,161 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#include "WorldMap/FCWorldMapDistanceField.h"
+
+#include "WorldMap/FCWorldMapBitMask.h"
+#include "WorldMap/FCWorldMapStats.h"
+
+namespace FCWorldMapDistanceFieldChamfer
+{
+	/** Chamfer weights in tenths of a cell */
+	constexpr int32 Orthogonal = 10;
+	constexpr int32 Diagonal = 14;
+
+	/** Cells on either side of the edge are half a cell from it */
+	constexpr uint16 EdgeSeed = 5;
+
+	constexpr uint16 Far = MAX_uint16 / 2;
+}
+
+void FFCWorldMapDistanceField::Rebuild(const FFCWorldMapBitMask& Reveal)
+{
+	SCOPE_CYCLE_COUNTER(STAT_FCWorldMap_DistanceField);
+
+	Width = Reveal.GetWidth();
+	Height = Reveal.GetHeight();
+	Texels.SetNumUninitialized(Width * Height);
+
+	RecomputeRect(Reveal, FIntRect(0, 0, Width, Height));
+}
+
+FIntRect FFCWorldMapDistanceField::Update(const FFCWorldMapBitMask& Reveal, const FIntRect& ChangedRect)
+{
+	SCOPE_CYCLE_COUNTER(STAT_FCWorldMap_DistanceField);
+
+	if (Reveal.GetWidth() != Width || Reveal.GetHeight() != Height)
+	{
+		Rebuild(Reveal);
+		return FIntRect(0, 0, Width, Height);
+	}
+
+	// A changed cell moves the edge by at most one cell, and texels saturate MaxDistanceCells past it.
+	FIntRect WriteRect = ChangedRect;
+	WriteRect.InflateRect(MaxDistanceCells + 1);
+	WriteRect.Clip(FIntRect(0, 0, Width, Height));
+	if (WriteRect.IsEmpty())
+	{
+		return FIntRect();
+	}
+
+	RecomputeRect(Reveal, WriteRect);
+	return WriteRect;
+}
+
+void FFCWorldMapDistanceField::CopyRect(const FIntRect& Rect, uint8* OutBytes, int32 Pitch) const
+{
+	for (int32 Y = Rect.Min.Y; Y < Rect.Max.Y; ++Y)
+	{
+		FMemory::Memcpy(OutBytes + (Y - Rect.Min.Y) * Pitch, Texels.GetData() + Rect.Min.X + Y * Width, Rect.Width());
+	}
+}
+
+void FFCWorldMapDistanceField::RecomputeRect(const FFCWorldMapBitMask& Reveal, const FIntRect& WriteRect)
+{
+	using namespace FCWorldMapDistanceFieldChamfer;
+
+	// Any edge cell closer than the saturation distance to WriteRect lies inside this window,
+	// and so does the shortest chamfer path to it.
+	FIntRect Window = WriteRect;
+	Window.InflateRect(MaxDistanceCells + 1);
+	Window.Clip(FIntRect(0, 0, Width, Height));
+
+	const int32 WindowW = Window.Width();
+	const int32 WindowH = Window.Height();
+	Scratch.SetNumUninitialized(WindowW * WindowH, EAllowShrinking::No);
+
+	// Seed every cell with a 4-neighbour of the other state (neighbours outside the window still count).
+	for (int32 Y = 0; Y < WindowH; ++Y)
+	{
+		const int32 GY = Window.Min.Y + Y;
+		for (int32 X = 0; X < WindowW; ++X)
+		{
+			const int32 GX = Window.Min.X + X;
+			const bool bRevealed = Reveal.GetXY(GX, GY);
+			const bool bEdge = (GX > 0 && Reveal.GetXY(GX - 1, GY) != bRevealed)
+				|| (GX + 1 < Width && Reveal.GetXY(GX + 1, GY) != bRevealed)
+				|| (GY > 0 && Reveal.GetXY(GX, GY - 1) != bRevealed)
+				|| (GY + 1 < Height && Reveal.GetXY(GX, GY + 1) != bRevealed);
+			Scratch[X + Y * WindowW] = bEdge ? EdgeSeed : Far;
+		}
+	}
+
+	// Forward pass: west, north-west, north, north-east
+	for (int32 Y = 0; Y < WindowH; ++Y)
+	{
+		uint16* Row = Scratch.GetData() + Y * WindowW;
+		const uint16* Above = Y > 0 ? Row - WindowW : nullptr;
+		for (int32 X = 0; X < WindowW; ++X)
+		{
+			int32 D = Row[X];
+			if (X > 0)
+			{
+				D = FMath::Min(D, Row[X - 1] + Orthogonal);
+			}
+			if (Above)
+			{
+				D = FMath::Min(D, Above[X] + Orthogonal);
+				if (X > 0)
+				{
+					D = FMath::Min(D, Above[X - 1] + Diagonal);
+				}
+				if (X + 1 < WindowW)
+				{
+					D = FMath::Min(D, Above[X + 1] + Diagonal);
+				}
+			}
+			Row[X] = static_cast<uint16>(D);
+		}
+	}
+
+	// Backward pass: east, south-east, south, south-west
+	for (int32 Y = WindowH - 1; Y >= 0; --Y)
+	{
+		uint16* Row = Scratch.GetData() + Y * WindowW;
+		const uint16* Below = Y + 1 < WindowH ? Row + WindowW : nullptr;
+		for (int32 X = WindowW - 1; X >= 0; --X)
+		{
+			int32 D = Row[X];
+			if (X + 1 < WindowW)
+			{
+				D = FMath::Min(D, Row[X + 1] + Orthogonal);
+			}
+			if (Below)
+			{
+				D = FMath::Min(D, Below[X] + Orthogonal);
+				if (X + 1 < WindowW)
+				{
+					D = FMath::Min(D, Below[X + 1] + Diagonal);
+				}
+				if (X > 0)
+				{
+					D = FMath::Min(D, Below[X - 1] + Diagonal);
+				}
+			}
+			Row[X] = static_cast<uint16>(D);
+		}
+	}
+
+	// Encode: 128 +/- 127.5 * distance / saturation distance, revealed side positive.
+	constexpr float MaxUnits = MaxDistanceCells * Orthogonal;
+	for (int32 GY = WriteRect.Min.Y; GY < WriteRect.Max.Y; ++GY)
+	{
+		const uint16* Row = Scratch.GetData() + (GY - Window.Min.Y) * WindowW;
+		uint8* Out = Texels.GetData() + GY * Width;
+		for (int32 GX = WriteRect.Min.X; GX < WriteRect.Max.X; ++GX)
+		{
+			const float Distance = FMath::Min<float>(Row[GX - Window.Min.X], MaxUnits) / MaxUnits;
+			const float Signed = Reveal.GetXY(GX, GY) ? Distance : -Distance;
+			Out[GX] = static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(127.5f + Signed * 127.5f), 0, 255));
+		}
+	}
+}
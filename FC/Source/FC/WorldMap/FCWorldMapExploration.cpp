@@ -7,11 +7,20 @@
 
 #include "Logging/LogMacros.h"
 #include "Expedition/FCExpeditionManager.h" // for LogFCWorldMap declaration
+#include "WorldMap/FCWorldMapTerrainCostTable.h"
 
 FFCWorldMapExploration::FFCWorldMapExploration()
 {
-	RevealMask.Init(0, GlobalCount);
-	LandMask.Init(1, GlobalCount); // Default to land everywhere until a mask is provided.
+	RevealMask.Init(GlobalSize, GlobalSize, false);
+	LandMask.Init(GlobalSize, GlobalSize, true); // Default to land everywhere until a mask is provided.
+	RebuildTraversableMask();
+
+	TerrainClasses.SetNumUninitialized(GlobalCount);
+	CellMoney.SetNumUninitialized(GlobalCount);
+	CellRisk.SetNumUninitialized(GlobalCount);
+	CellTime.SetNumUninitialized(GlobalCount);
+	CellStepCost.SetNumUninitialized(GlobalCount);
+	SetTerrainCosts(TArray<FFCWorldMapTerrainCost>());
 }
 
 bool FFCWorldMapExploration::IsValidGridId(int32 GridId)
@@ -102,7 +111,7 @@ bool FFCWorldMapExploration::IsRevealed_Global(int32 GlobalId) const
 		return false;
 	}
 
-	return RevealMask[GlobalId] >= 128;
+	return RevealMask.Get(GlobalId);
 }
 
 bool FFCWorldMapExploration::SetRevealed_Global(int32 GlobalId, bool bRevealed)
@@ -112,22 +121,182 @@ bool FFCWorldMapExploration::SetRevealed_Global(int32 GlobalId, bool bRevealed)
 		return false;
 	}
 
-	const uint8 NewValue = bRevealed ? 255 : 0;
-	if (RevealMask[GlobalId] == NewValue)
+	if (!SetRevealedInternal(GlobalId, bRevealed))
 	{
 		return false;
 	}
 
-	RevealMask[GlobalId] = NewValue;
+	++Generation;
 	return true;
 }
 
+bool FFCWorldMapExploration::SetRevealedInternal(int32 GlobalId, bool bRevealed)
+{
+	if (!RevealMask.Set(GlobalId, bRevealed))
+	{
+		return false;
+	}
+
+	RefreshTraversable_Global(GlobalId);
+	RefreshCellCosts_Global(GlobalId);
+	Hierarchy.MarkCellDirty(GlobalId);
+	return true;
+}
+
+const TArray<int32>& FFCWorldMapExploration::GetDiscHalfWidths(int32 RadiusCells)
+{
+	// Built once (thread-safe static init); row DY of radius R spans [-HalfWidth, +HalfWidth].
+	static const TArray<TArray<int32>> SpanTable = []()
+	{
+		TArray<TArray<int32>> Table;
+		Table.SetNum(MaxRevealRadius + 1);
+		for (int32 Radius = 0; Radius <= MaxRevealRadius; ++Radius)
+		{
+			const float RadiusSq = FMath::Square(Radius + 0.5f);
+			TArray<int32>& Rows = Table[Radius];
+			Rows.SetNumUninitialized(Radius * 2 + 1);
+			for (int32 DY = -Radius; DY <= Radius; ++DY)
+			{
+				Rows[DY + Radius] = FMath::FloorToInt(FMath::Sqrt(RadiusSq - DY * DY));
+			}
+		}
+		return Table;
+	}();
+
+	return SpanTable[FMath::Clamp(RadiusCells, 0, MaxRevealRadius)];
+}
+
+int32 FFCWorldMapExploration::RevealDisc_Global(int32 CenterGX, int32 CenterGY, int32 RadiusCells, FIntRect& OutChangedRect)
+{
+	OutChangedRect = FIntRect();
+
+	const int32 Radius = FMath::Clamp(RadiusCells, 0, MaxRevealRadius);
+	const TArray<int32>& HalfWidths = GetDiscHalfWidths(Radius);
+
+	int32 NumRevealed = 0;
+	for (int32 DY = -Radius; DY <= Radius; ++DY)
+	{
+		const int32 GY = CenterGY + DY;
+		if (GY < 0 || GY >= GlobalSize)
+		{
+			continue;
+		}
+
+		const int32 HalfWidth = HalfWidths[DY + Radius];
+		const int32 MinX = FMath::Max(CenterGX - HalfWidth, 0);
+		const int32 MaxX = FMath::Min(CenterGX + HalfWidth, GlobalSize - 1);
+
+		// Whole row span already revealed: nothing to do (word-parallel check).
+		const FIntRect RowSpan(MinX, GY, MaxX + 1, GY + 1);
+		if (MinX > MaxX || RevealMask.AllInRect(RowSpan))
+		{
+			continue;
+		}
+
+		for (int32 GX = MinX; GX <= MaxX; ++GX)
+		{
+			if (SetRevealedInternal(XYToGlobalId(GX, GY), true))
+			{
+				if (NumRevealed == 0)
+				{
+					OutChangedRect = FIntRect(GX, GY, GX + 1, GY + 1);
+				}
+				else
+				{
+					OutChangedRect.Union(FIntRect(GX, GY, GX + 1, GY + 1));
+				}
+				++NumRevealed;
+			}
+		}
+	}
+
+	if (NumRevealed > 0)
+	{
+		++Generation;
+	}
+
+	return NumRevealed;
+}
+
+void FFCWorldMapExploration::SetRevealMask(const FFCWorldMapBitMask& InRevealMask)
+{
+	if (InRevealMask.GetWidth() != GlobalSize || InRevealMask.GetHeight() != GlobalSize)
+	{
+		return;
+	}
+
+	if (RevealMask == InRevealMask)
+	{
+		return;
+	}
+
+	RevealMask.ForEachDifference(InRevealMask, [this](int32 GlobalId)
+	{
+		Hierarchy.MarkCellDirty(GlobalId);
+	});
+
+	RevealMask = InRevealMask;
+	++Generation;
+	RebuildTraversableMask();
+	RebuildCellCosts();
+}
+
+void FFCWorldMapExploration::GetRevealMaskBytes(TArray<uint8>& OutBytes) const
+{
+	RevealMask.ExpandToBytes(OutBytes, 255, 0);
+}
+
+void FFCWorldMapExploration::SetRevealMaskFromBytes(const TArray<uint8>& InBytes)
+{
+	if (InBytes.Num() != GlobalCount)
+	{
+		return;
+	}
+
+	FFCWorldMapBitMask NewRevealMask(GlobalSize, GlobalSize);
+	NewRevealMask.FromBytes(InBytes, 128);
+	SetRevealMask(NewRevealMask);
+}
+
 void FFCWorldMapExploration::SetLandMask(const TArray<uint8>& InLandMask)
 {
-	if (InLandMask.Num() == GlobalCount)
+	if (InLandMask.Num() != GlobalCount)
+	{
+		return;
+	}
+
+	FFCWorldMapBitMask NewLandMask(GlobalSize, GlobalSize);
+	NewLandMask.FromBytes(InLandMask, 1);
+	SetLandMask(NewLandMask);
+}
+
+void FFCWorldMapExploration::SetLandMask(const FFCWorldMapBitMask& InLandMask)
+{
+	if (InLandMask.GetWidth() != GlobalSize || InLandMask.GetHeight() != GlobalSize)
 	{
-		LandMask = InLandMask;
+		return;
 	}
+
+	if (LandMask == InLandMask)
+	{
+		return;
+	}
+
+	// Invalidate only the areas whose terrain actually changed.
+	LandMask.ForEachDifference(InLandMask, [this](int32 GlobalId)
+	{
+		Hierarchy.MarkCellDirty(GlobalId);
+	});
+
+	LandMask = InLandMask;
+	++Generation;
+	RebuildTraversableMask();
+	RebuildCellCosts();
+}
+
+void FFCWorldMapExploration::GetLandMaskBytes(TArray<uint8>& OutBytes) const
+{
+	LandMask.ExpandToBytes(OutBytes, 1, 0);
 }
 
 bool FFCWorldMapExploration::IsLand_Global(int32 GlobalId) const
@@ -137,7 +306,120 @@ bool FFCWorldMapExploration::IsLand_Global(int32 GlobalId) const
 		return false;
 	}
 
-	return LandMask[GlobalId] != 0;
+	return LandMask.Get(GlobalId);
+}
+
+void FFCWorldMapExploration::RefreshTraversable_Global(int32 GlobalId)
+{
+	const bool bTraversable = !LandMask.Get(GlobalId) || RevealMask.Get(GlobalId);
+	if (!TraversableMask.Set(GlobalId, bTraversable))
+	{
+		return;
+	}
+
+	if (bTraversable)
+	{
+		// Reveals only ever merge components, which union-find handles incrementally.
+		Components.AddCell(TraversableMask, GlobalId);
+	}
+	else
+	{
+		// Hiding a cell can split a component; relabel (debug/editor paths only).
+		Components.Rebuild(TraversableMask);
+	}
+}
+
+void FFCWorldMapExploration::RebuildTraversableMask()
+{
+	// Traversable = ~Land | Revealed, a word at a time.
+	TraversableMask = LandMask;
+	TraversableMask.Invert();
+	TraversableMask.Or(RevealMask);
+
+	Components.Rebuild(TraversableMask);
+}
+
+bool FFCWorldMapExploration::IsReachable_Global(int32 StartGlobalId, int32 GoalGlobalId) const
+{
+	if (!IsValidGlobalId(StartGlobalId) || !IsValidGlobalId(GoalGlobalId) || !LandMask.Get(GoalGlobalId))
+	{
+		return false;
+	}
+
+	if (StartGlobalId == GoalGlobalId)
+	{
+		return true;
+	}
+
+	const int32 StartComponent = Components.GetComponent(StartGlobalId);
+	if (StartComponent == INDEX_NONE)
+	{
+		return false;
+	}
+
+	if (TraversableMask.Get(GoalGlobalId))
+	{
+		return Components.GetComponent(GoalGlobalId) == StartComponent;
+	}
+
+	// Unrevealed land goal: reachable if any 4-neighbour is in the start component.
+	int32 GX, GY;
+	GlobalIdToXY(GoalGlobalId, GX, GY);
+
+	static const FIntPoint NeighborOffsets[] = { {1, 0}, {-1, 0}, {0, 1}, {0, -1} };
+	for (const FIntPoint& Offset : NeighborOffsets)
+	{
+		const int32 NX = GX + Offset.X;
+		const int32 NY = GY + Offset.Y;
+		if (IsValidGlobal(NX, NY) && Components.GetComponent(XYToGlobalId(NX, NY)) == StartComponent)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FFCWorldMapExploration::BuildReachableGoalMask(int32 StartGlobalId, FFCWorldMapBitMask& OutMask) const
+{
+	OutMask.Init(GlobalSize, GlobalSize, false);
+
+	const int32 StartComponent = Components.GetComponent(StartGlobalId);
+	if (StartComponent != INDEX_NONE)
+	{
+		for (int32 GlobalId = 0; GlobalId < GlobalCount; ++GlobalId)
+		{
+			if (Components.GetComponent(GlobalId) == StartComponent)
+			{
+				OutMask.Set(GlobalId, true);
+			}
+		}
+
+		// Goals are land cells inside the component or one step off its edge.
+		OutMask.Dilate4();
+		OutMask.And(LandMask);
+	}
+
+	if (IsValidGlobalId(StartGlobalId) && LandMask.Get(StartGlobalId))
+	{
+		OutMask.Set(StartGlobalId, true);
+	}
+}
+
+void FFCWorldMapExploration::BuildReachableAreas(int32 StartGlobalId, TBitArray<>& OutReachableGridIds) const
+{
+	FFCWorldMapBitMask GoalMask;
+	BuildReachableGoalMask(StartGlobalId, GoalMask);
+
+	OutReachableGridIds.Init(false, GridSize * GridSize);
+	for (int32 GridId = 0; GridId < GridSize * GridSize; ++GridId)
+	{
+		int32 AreaX, AreaY;
+		GridIdToXY(GridId, AreaX, AreaY);
+
+		const FIntRect AreaRect(AreaX * SubSize, AreaY * SubSize, (AreaX + 1) * SubSize, (AreaY + 1) * SubSize);
+		OutReachableGridIds[GridId] = GoalMask.AnyInRect(AreaRect);
+	}
 }
 
 void FFCWorldMapExploration::ApplyDefaultRevealedAreas_NewGame(const TArray<int32>& DefaultGridIds)
@@ -156,7 +438,7 @@ void FFCWorldMapExploration::ApplyDefaultRevealedAreas_NewGame(const TArray<int3
 				const int32 GlobalX = AreaX * SubSize + SX;
 				const int32 GlobalY = AreaY * SubSize + SY;
 				const int32 GlobalId = XYToGlobalId(GlobalX, GlobalY);
-				SetRevealed_Global(GlobalId, true);
+				SetRevealedInternal(GlobalId, true);
 			}
 		}
 	};
@@ -172,14 +454,134 @@ void FFCWorldMapExploration::ApplyDefaultRevealedAreas_NewGame(const TArray<int3
 		RevealAreaFully(GridId);
 	}
 
+	++Generation;
+
 	UE_LOG(LogFCWorldMap, Log, TEXT("FFCWorldMapExploration::ApplyDefaultRevealedAreas_NewGame: Completed default reveal"));
 }
 
-bool FFCWorldMapExploration::FindShortestPath_BFS(int32 StartGlobalId, int32 GoalGlobalId, TArray<int32>& OutPath) const
+void FFCWorldMapExploration::SetTerrainClasses(const TArray<uint8>& InClasses)
 {
-	OutPath.Reset();
+	if (InClasses.Num() != 0 && InClasses.Num() != GlobalCount)
+	{
+		UE_LOG(LogFCWorldMap, Warning, TEXT("SetTerrainClasses: Ignoring layer with %d cells (expected %d)"), InClasses.Num(), GlobalCount);
+		return;
+	}
+
+	bHasTerrainClassLayer = InClasses.Num() == GlobalCount;
+	if (bHasTerrainClassLayer)
+	{
+		FMemory::Memcpy(TerrainClasses.GetData(), InClasses.GetData(), GlobalCount);
+	}
+
+	// Costs may change anywhere, so every cached area cost goes.
+	RebuildCellCosts();
+	Hierarchy.MarkAllDirty();
+	++Generation;
+}
+
+uint8 FFCWorldMapExploration::GetTerrainClass_Global(int32 GlobalId) const
+{
+	return IsValidGlobalId(GlobalId) ? TerrainClasses[GlobalId] : DefaultLandClass;
+}
+
+void FFCWorldMapExploration::SetTerrainCosts(const TArray<FFCWorldMapTerrainCost>& InCosts)
+{
+	auto ToCost = [](int32 Value)
+	{
+		return static_cast<uint16>(FMath::Clamp(Value, 0, 1000));
+	};
+
+	// Indexed by class byte, so every byte value has an entry and lookups need no bounds check.
+	ClassCosts.SetNum(256);
+	if (InCosts.Num() == 0)
+	{
+		ClassCosts[DefaultLandClass] = FClassCosts{ 1, 1, 1, 0 };
+		ClassCosts[DefaultWaterClass] = FClassCosts{ 3, 2, 1, 1 };
+		for (int32 Class = 2; Class < ClassCosts.Num(); ++Class)
+		{
+			ClassCosts[Class] = ClassCosts[DefaultLandClass];
+		}
+	}
+	else
+	{
+		for (int32 Class = 0; Class < ClassCosts.Num(); ++Class)
+		{
+			const FFCWorldMapTerrainCost& Cost = InCosts.IsValidIndex(Class) ? InCosts[Class] : InCosts[0];
+			ClassCosts[Class] = FClassCosts{ ToCost(Cost.Money), ToCost(Cost.Risk), ToCost(Cost.Time), ToCost(Cost.UnrevealedRisk) };
+		}
+	}
+
+	// Revealed cost is the floor of every class; zero-cost steps would make the heuristics inadmissible.
+	MinStepCost = MAX_int32;
+	const int32 NumUsedClasses = InCosts.Num() == 0 ? 2 : InCosts.Num();
+	for (int32 Class = 0; Class < NumUsedClasses; ++Class)
+	{
+		MinStepCost = FMath::Min<int32>(MinStepCost, ClassCosts[Class].Money + ClassCosts[Class].Risk);
+	}
+	if (MinStepCost < 1)
+	{
+		UE_LOG(LogFCWorldMap, Warning, TEXT("SetTerrainCosts: A class has zero money + risk; treating its step cost as 1"));
+		MinStepCost = 1;
+	}
+
+	RebuildCellCosts();
+	Hierarchy.MarkAllDirty();
+	++Generation;
+}
 
-	UE_LOG(LogFCWorldMap, Log, TEXT("FFCWorldMapExploration::FindShortestPath_BFS: Start=%d, Goal=%d"), StartGlobalId, GoalGlobalId);
+void FFCWorldMapExploration::RefreshCellCosts_Global(int32 GlobalId)
+{
+	const FClassCosts& Costs = ClassCosts[TerrainClasses[GlobalId]];
+	const uint16 Risk = Costs.Risk + (RevealMask.Get(GlobalId) ? 0 : Costs.UnrevealedRisk);
+
+	CellMoney[GlobalId] = Costs.Money;
+	CellRisk[GlobalId] = Risk;
+	CellTime[GlobalId] = Costs.Time;
+	CellStepCost[GlobalId] = static_cast<uint16>(FMath::Max<int32>(Costs.Money + Risk, MinStepCost));
+}
+
+void FFCWorldMapExploration::RebuildCellCosts()
+{
+	if (!bHasTerrainClassLayer)
+	{
+		for (int32 GlobalId = 0; GlobalId < GlobalCount; ++GlobalId)
+		{
+			TerrainClasses[GlobalId] = LandMask.Get(GlobalId) ? DefaultLandClass : DefaultWaterClass;
+		}
+	}
+
+	for (int32 GlobalId = 0; GlobalId < GlobalCount; ++GlobalId)
+	{
+		RefreshCellCosts_Global(GlobalId);
+	}
+}
+
+void FFCWorldMapExploration::GetCellCosts_Global(int32 GlobalId, int32& OutMoney, int32& OutRisk) const
+{
+	int32 Time;
+	GetCellCosts_Global(GlobalId, OutMoney, OutRisk, Time);
+}
+
+void FFCWorldMapExploration::GetCellCosts_Global(int32 GlobalId, int32& OutMoney, int32& OutRisk, int32& OutTime) const
+{
+	if (!IsValidGlobalId(GlobalId))
+	{
+		OutMoney = OutRisk = OutTime = 0;
+		return;
+	}
+
+	OutMoney = CellMoney[GlobalId];
+	OutRisk = CellRisk[GlobalId];
+	OutTime = CellTime[GlobalId];
+}
+
+bool FFCWorldMapExploration::FindShortestPath_BFS(int32 StartGlobalId, int32 GoalGlobalId, TArray<int32>& OutPath, FFCWorldMapPathStats* OutStats) const
+{
+	OutPath.Reset();
+	if (OutStats)
+	{
+		*OutStats = FFCWorldMapPathStats();
+	}
 
 	if (!IsValidGlobalId(StartGlobalId) || !IsValidGlobalId(GoalGlobalId))
 	{
@@ -193,6 +595,12 @@ bool FFCWorldMapExploration::FindShortestPath_BFS(int32 StartGlobalId, int32 Goa
 		return false;
 	}
 
+	if (!IsReachable_Global(StartGlobalId, GoalGlobalId))
+	{
+		UE_LOG(LogFCWorldMap, Verbose, TEXT("FindShortestPath_BFS: Goal %d not in start component - rejected without search"), GoalGlobalId);
+		return false;
+	}
+
 	TArray<int32> CameFrom;
 	CameFrom.Init(-1, GlobalCount);
 
@@ -200,35 +608,6 @@ bool FFCWorldMapExploration::FindShortestPath_BFS(int32 StartGlobalId, int32 Goa
 	Frontier.Enqueue(StartGlobalId);
 	CameFrom[StartGlobalId] = StartGlobalId;
 
-	// Debug: Log 8-neighborhood around goal cell with land/reveal info.
-	{
-		int32 GX, GY;
-		GlobalIdToXY(GoalGlobalId, GX, GY);
-		const int32 Offsets[8][2] = {
-			{ -1, -1 }, { 0, -1 }, { 1, -1 },
-			{ -1,  0 },             { 1,  0 },
-			{ -1,  1 }, { 0,  1 }, { 1,  1 }
-		};
-
-		for (int32 I = 0; I < 8; ++I)
-		{
-			const int32 NX = GX + Offsets[I][0];
-			const int32 NY = GY + Offsets[I][1];
-			if (!IsValidGlobal(NX, NY))
-			{
-				continue;
-			}
-
-			const int32 NeighborId = XYToGlobalId(NX, NY);
-			const bool bIsLand = IsLand_Global(NeighborId);
-			const bool bIsRev = IsRevealed_Global(NeighborId);
-			UE_LOG(LogFCWorldMap, Log, TEXT("GoalNeighborhood: GlobalId=%d IsLand=%s IsRevealed=%s"),
-				NeighborId,
-				bIsLand ? TEXT("true") : TEXT("false"),
-				bIsRev ? TEXT("true") : TEXT("false"));
-		}
-	}
-
 	bool bFound = false;
 
 	while (!Frontier.IsEmpty())
@@ -236,10 +615,14 @@ bool FFCWorldMapExploration::FindShortestPath_BFS(int32 StartGlobalId, int32 Goa
 		int32 Current;
 		Frontier.Dequeue(Current);
 
+		if (OutStats)
+		{
+			++OutStats->NodesExpanded;
+		}
+
 		if (Current == GoalGlobalId)
 		{
 			bFound = true;
-			UE_LOG(LogFCWorldMap, Verbose, TEXT("FindShortestPath_BFS: Reached goal %d"), GoalGlobalId);
 			break;
 		}
 
@@ -255,7 +638,6 @@ bool FFCWorldMapExploration::FindShortestPath_BFS(int32 StartGlobalId, int32 Goa
 			const int32 NY = NeighborY[Index];
 			if (!IsValidGlobal(NX, NY))
 			{
-				UE_LOG(LogFCWorldMap, VeryVerbose, TEXT("FindShortestPath_BFS: Neighbor out of bounds NX=%d NY=%d"), NX, NY);
 				continue;
 			}
 
@@ -283,6 +665,220 @@ bool FFCWorldMapExploration::FindShortestPath_BFS(int32 StartGlobalId, int32 Goa
 		return false;
 	}
 
+	if (!ReconstructPath(CameFrom, StartGlobalId, GoalGlobalId, OutPath))
+	{
+		UE_LOG(LogFCWorldMap, Warning, TEXT("FindShortestPath_BFS: Broken predecessor chain while reconstructing path"));
+		return false;
+	}
+
+	if (OutStats)
+	{
+		for (int32 Index = 1; Index < OutPath.Num(); ++Index)
+		{
+			OutStats->PathCost += GetStepCost_Global(OutPath[Index]);
+		}
+	}
+
+	UE_LOG(LogFCWorldMap, Verbose, TEXT("FindShortestPath_BFS: Path found with %d nodes"), OutPath.Num());
+	return true;
+}
+
+bool FFCWorldMapExploration::FindCheapestPath_AStar(int32 StartGlobalId, int32 GoalGlobalId, TArray<int32>& OutPath, FFCWorldMapPathStats* OutStats) const
+{
+	OutPath.Reset();
+	if (OutStats)
+	{
+		*OutStats = FFCWorldMapPathStats();
+	}
+
+	if (!IsValidGlobalId(StartGlobalId) || !IsValidGlobalId(GoalGlobalId))
+	{
+		UE_LOG(LogFCWorldMap, Warning, TEXT("FindCheapestPath_AStar: Invalid Start(%d) or Goal(%d)"), StartGlobalId, GoalGlobalId);
+		return false;
+	}
+
+	if (!IsTraversable_Global(StartGlobalId, GoalGlobalId))
+	{
+		UE_LOG(LogFCWorldMap, Warning, TEXT("FindCheapestPath_AStar: Start cell %d not traversable"), StartGlobalId);
+		return false;
+	}
+
+	if (!IsReachable_Global(StartGlobalId, GoalGlobalId))
+	{
+		UE_LOG(LogFCWorldMap, Verbose, TEXT("FindCheapestPath_AStar: Goal %d not in start component - rejected without search"), GoalGlobalId);
+		return false;
+	}
+
+	struct FOpenNode
+	{
+		int32 GlobalId;
+		int32 GScore;
+		int32 FScore;
+	};
+
+	// Lowest F first; on ties prefer the deeper node so the search runs along the goal direction.
+	auto OpenLess = [](const FOpenNode& A, const FOpenNode& B)
+	{
+		return A.FScore < B.FScore || (A.FScore == B.FScore && A.GScore > B.GScore);
+	};
+
+	int32 GoalX, GoalY;
+	GlobalIdToXY(GoalGlobalId, GoalX, GoalY);
+
+	auto Heuristic = [GoalX, GoalY, HeuristicStepCost = MinStepCost](int32 X, int32 Y)
+	{
+		return (FMath::Abs(X - GoalX) + FMath::Abs(Y - GoalY)) * HeuristicStepCost;
+	};
+
+	TArray<int32> GScore;
+	GScore.Init(MAX_int32, GlobalCount);
+
+	TArray<int32> CameFrom;
+	CameFrom.Init(-1, GlobalCount);
+
+	TArray<FOpenNode> Open;
+	Open.Reserve(1024);
+
+	{
+		int32 StartX, StartY;
+		GlobalIdToXY(StartGlobalId, StartX, StartY);
+		GScore[StartGlobalId] = 0;
+		CameFrom[StartGlobalId] = StartGlobalId;
+		Open.HeapPush(FOpenNode{ StartGlobalId, 0, Heuristic(StartX, StartY) }, OpenLess);
+	}
+
+	bool bFound = false;
+
+	while (Open.Num() > 0)
+	{
+		FOpenNode Current;
+		Open.HeapPop(Current, OpenLess, EAllowShrinking::No);
+
+		// Stale heap entry: a cheaper route to this cell was already expanded.
+		if (Current.GScore > GScore[Current.GlobalId])
+		{
+			continue;
+		}
+
+		if (OutStats)
+		{
+			++OutStats->NodesExpanded;
+		}
+
+		if (Current.GlobalId == GoalGlobalId)
+		{
+			bFound = true;
+			break;
+		}
+
+		int32 X, Y;
+		GlobalIdToXY(Current.GlobalId, X, Y);
+
+		const int32 NeighborX[4] = { X + 1, X - 1, X,     X };
+		const int32 NeighborY[4] = { Y,     Y,     Y + 1, Y - 1 };
+
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			const int32 NX = NeighborX[Index];
+			const int32 NY = NeighborY[Index];
+			if (!IsValidGlobal(NX, NY))
+			{
+				continue;
+			}
+
+			const int32 NeighborId = XYToGlobalId(NX, NY);
+			if (!IsTraversable_Global(NeighborId, GoalGlobalId))
+			{
+				continue;
+			}
+
+			const int32 TentativeG = Current.GScore + GetStepCost_Global(NeighborId);
+			if (TentativeG >= GScore[NeighborId])
+			{
+				continue;
+			}
+
+			GScore[NeighborId] = TentativeG;
+			CameFrom[NeighborId] = Current.GlobalId;
+			Open.HeapPush(FOpenNode{ NeighborId, TentativeG, TentativeG + Heuristic(NX, NY) }, OpenLess);
+		}
+	}
+
+	if (!bFound)
+	{
+		UE_LOG(LogFCWorldMap, Warning, TEXT("FindCheapestPath_AStar: Failed to find path from %d to %d"), StartGlobalId, GoalGlobalId);
+		return false;
+	}
+
+	if (!ReconstructPath(CameFrom, StartGlobalId, GoalGlobalId, OutPath))
+	{
+		UE_LOG(LogFCWorldMap, Warning, TEXT("FindCheapestPath_AStar: Broken predecessor chain while reconstructing path"));
+		return false;
+	}
+
+	if (OutStats)
+	{
+		OutStats->PathCost = GScore[GoalGlobalId];
+	}
+
+	UE_LOG(LogFCWorldMap, Verbose, TEXT("FindCheapestPath_AStar: Path found with %d nodes (Cost=%d)"), OutPath.Num(), GScore[GoalGlobalId]);
+	return true;
+}
+
+bool FFCWorldMapExploration::FindPath_Hierarchical(int32 StartGlobalId, int32 GoalGlobalId, TArray<int32>& OutPath, FFCWorldMapPathStats* OutStats)
+{
+	Hierarchy.Refresh(*this);
+	return static_cast<const FFCWorldMapExploration*>(this)->FindPath_Hierarchical(StartGlobalId, GoalGlobalId, OutPath, OutStats);
+}
+
+bool FFCWorldMapExploration::FindPath_Hierarchical(int32 StartGlobalId, int32 GoalGlobalId, TArray<int32>& OutPath, FFCWorldMapPathStats* OutStats) const
+{
+	if (!IsReachable_Global(StartGlobalId, GoalGlobalId))
+	{
+		OutPath.Reset();
+		if (OutStats)
+		{
+			*OutStats = FFCWorldMapPathStats();
+		}
+		UE_LOG(LogFCWorldMap, Verbose, TEXT("FindPath_Hierarchical: Goal %d unreachable from %d - rejected without search"), GoalGlobalId, StartGlobalId);
+		return false;
+	}
+
+	return Hierarchy.FindPath(*this, StartGlobalId, GoalGlobalId, OutPath, OutStats);
+}
+
+void FFCWorldMapExploration::ComputePathCosts(const TArray<int32>& Path, int32& OutMoney, int32& OutRisk) const
+{
+	int32 Time;
+	ComputePathCosts(Path, OutMoney, OutRisk, Time);
+}
+
+void FFCWorldMapExploration::ComputePathCosts(const TArray<int32>& Path, int32& OutMoney, int32& OutRisk, int32& OutTime) const
+{
+	OutMoney = 0;
+	OutRisk = 0;
+	OutTime = 0;
+
+	const uint16* Money = CellMoney.GetData();
+	const uint16* Risk = CellRisk.GetData();
+	const uint16* Time = CellTime.GetData();
+
+	// Path[0] is the start cell, which is not charged. Planners only emit valid ids,
+	// so the loop is a plain gather-and-sum.
+	for (int32 Index = 1; Index < Path.Num(); ++Index)
+	{
+		const int32 GlobalId = Path[Index];
+		checkSlow(IsValidGlobalId(GlobalId));
+		OutMoney += Money[GlobalId];
+		OutRisk += Risk[GlobalId];
+		OutTime += Time[GlobalId];
+	}
+}
+
+bool FFCWorldMapExploration::ReconstructPath(const TArray<int32>& CameFrom, int32 StartGlobalId, int32 GoalGlobalId, TArray<int32>& OutPath)
+{
+	OutPath.Reset();
+
 	int32 Node = GoalGlobalId;
 	while (Node != StartGlobalId)
 	{
@@ -290,15 +886,13 @@ bool FFCWorldMapExploration::FindShortestPath_BFS(int32 StartGlobalId, int32 Goa
 		Node = CameFrom[Node];
 		if (Node == -1)
 		{
-			UE_LOG(LogFCWorldMap, Warning, TEXT("FindShortestPath_BFS: Broken predecessor chain while reconstructing path"));
+			OutPath.Reset();
 			return false;
 		}
 	}
 	OutPath.Add(StartGlobalId);
 
 	Algo::Reverse(OutPath);
-
-	UE_LOG(LogFCWorldMap, Log, TEXT("FindShortestPath_BFS: Path found with %d nodes"), OutPath.Num());
 	return true;
 }
 
@@ -306,26 +900,14 @@ bool FFCWorldMapExploration::IsTraversable_Global(int32 GlobalId, int32 GoalGlob
 {
 	if (!IsValidGlobalId(GlobalId))
 	{
-		UE_LOG(LogFCWorldMap, VeryVerbose, TEXT("IsTraversable_Global: GlobalId %d invalid"), GlobalId);
 		return false;
 	}
 
+	// The goal only has to be land (it may still be unrevealed).
 	if (GlobalId == GoalGlobalId)
 	{
-		const bool bGoalIsLand = IsLand_Global(GlobalId);
-		UE_LOG(LogFCWorldMap, VeryVerbose, TEXT("IsTraversable_Global: Checking goal cell %d (IsLand=%s)"),
-			GlobalId, bGoalIsLand ? TEXT("true") : TEXT("false"));
-		return bGoalIsLand;
-	}
-
-	if (IsWater_Global(GlobalId))
-	{
-		UE_LOG(LogFCWorldMap, VeryVerbose, TEXT("IsTraversable_Global: GlobalId %d is water -> traversable"), GlobalId);
-		return true;
+		return LandMask.Get(GlobalId);
 	}
 
-	const bool bRevealed = IsRevealed_Global(GlobalId);
-	UE_LOG(LogFCWorldMap, VeryVerbose, TEXT("IsTraversable_Global: GlobalId %d land, revealed=%s"),
-		GlobalId, bRevealed ? TEXT("true") : TEXT("false"));
-	return bRevealed;
+	return TraversableMask.Get(GlobalId);
 }
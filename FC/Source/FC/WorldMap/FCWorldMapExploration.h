@@ -3,14 +3,35 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "WorldMap/FCWorldMapBitMask.h"
+#include "WorldMap/FCWorldMapComponents.h"
+#include "WorldMap/FCWorldMapHierarchy.h"
+
+struct FFCWorldMapTerrainCost;
 
 /**
  * FFCWorldMapExploration is a pure helper that manages global map masks.
  * - 16x16 areas, each with 16x16 subcells -> 256x256 global grid.
- * - Stores reveal (fog) and terrain (land/water) data as byte arrays.
+ * - Stores reveal (fog) and terrain (land/water) data as bit-packed masks (8 KB each).
+ * - Keeps a terrain-class byte per cell and flat per-cell money/risk/time arrays built from
+ *   the class cost table, so route costs and search weights are plain array reads.
+ * - Keeps a precomputed Water | Revealed mask so traversal checks are a single bit test.
  * - Provides conversion helpers between grid/sub/global indices.
- * - Supplies a BFS shortest-path implementation for milestone preview routes.
+ * - Supplies BFS (fewest steps) and A* (cheapest money/risk) route planners.
+ * - Labels connected components of traversable cells so unreachable goals are rejected up front.
+ * - Owns the area-level hierarchy (FFCWorldMapHierarchy) used for HPA*-style planning.
  */
+
+/** Per-search counters, used to compare planners on the same query. */
+struct FFCWorldMapPathStats
+{
+	/** Number of cells popped from the frontier and expanded */
+	int32 NodesExpanded = 0;
+
+	/** Summed step cost of the returned path (excluding the start cell) */
+	int32 PathCost = 0;
+};
+
 class FFCWorldMapExploration
 {
 public:
@@ -21,22 +42,54 @@ public:
 
 	FFCWorldMapExploration();
 
+	/**
+	 * Bumped on every reveal or land-mask change. Anything derived from the masks
+	 * (cached routes, snapshots, reachability) is valid only for the generation it was built at.
+	 */
+	uint32 GetGeneration() const { return Generation; }
+
 	// --- Reveal mask --------------------------------------------------------
 
-	const TArray<uint8>& GetRevealMask() const { return RevealMask; }
-	TArray<uint8>& GetRevealMaskMutable() { return RevealMask; }
+	const FFCWorldMapBitMask& GetRevealMask() const { return RevealMask; }
+
+	/** Replace the whole reveal mask (e.g. from a save); only changed areas are invalidated. */
+	void SetRevealMask(const FFCWorldMapBitMask& InRevealMask);
+
+	/** Legacy/texture byte layout: 255 revealed, 0 hidden. */
+	void GetRevealMaskBytes(TArray<uint8>& OutBytes) const;
+	void SetRevealMaskFromBytes(const TArray<uint8>& InBytes);
 
 	bool IsRevealed_Global(int32 GlobalId) const;
 	bool SetRevealed_Global(int32 GlobalId, bool bRevealed);
 
+	/**
+	 * Reveal brush: every cell within RadiusCells of (CenterGX, CenterGY), in one pass over
+	 * precomputed disc spans. Radius 0 reveals just the centre cell; radii are clamped to MaxRevealRadius.
+	 * Returns the number of newly revealed cells; OutChangedRect bounds them (empty when none).
+	 * The generation moves once per brush, not per cell.
+	 */
+	int32 RevealDisc_Global(int32 CenterGX, int32 CenterGY, int32 RadiusCells, FIntRect& OutChangedRect);
+
+	/** Largest brush radius with a precomputed span table. */
+	static constexpr int32 MaxRevealRadius = 64;
+
 	// --- Land mask ----------------------------------------------------------
 
-	const TArray<uint8>& GetLandMask() const { return LandMask; }
+	const FFCWorldMapBitMask& GetLandMask() const { return LandMask; }
+
+	/** Byte layout: non-zero = land. Must contain GlobalCount entries. */
 	void SetLandMask(const TArray<uint8>& InLandMask);
 
+	/** Replace the land mask (e.g. a saved override); only changed areas are invalidated. */
+	void SetLandMask(const FFCWorldMapBitMask& InLandMask);
+	void GetLandMaskBytes(TArray<uint8>& OutBytes) const;
+
 	bool IsLand_Global(int32 GlobalId) const;
 	bool IsWater_Global(int32 GlobalId) const { return !IsLand_Global(GlobalId); }
 
+	/** Water | Revealed, kept in sync by the setters above. */
+	const FFCWorldMapBitMask& GetTraversableMask() const { return TraversableMask; }
+
 	// --- Coordinate helpers -------------------------------------------------
 
 	static bool IsValidGridId(int32 GridId);
@@ -64,6 +117,44 @@ public:
 	 */
 	void ApplyDefaultRevealedAreas_NewGame(const TArray<int32>& DefaultGridIds);
 
+	// --- Terrain classes ----------------------------------------------------
+
+	/** Class of land cells when no terrain-class layer is set */
+	static constexpr uint8 DefaultLandClass = 0;
+
+	/** Class of water cells when no terrain-class layer is set */
+	static constexpr uint8 DefaultWaterClass = 1;
+
+	/**
+	 * One class byte per cell (GlobalCount entries). An empty array drops the layer, and classes
+	 * follow the land mask again (DefaultLandClass / DefaultWaterClass).
+	 */
+	void SetTerrainClasses(const TArray<uint8>& InClasses);
+
+	uint8 GetTerrainClass_Global(int32 GlobalId) const;
+
+	/**
+	 * Costs per class, indexed by class byte; classes past the end use entry 0. An empty
+	 * array restores the defaults: land money 1 / risk 1, water money 3 / risk 2 (+1 unrevealed).
+	 */
+	void SetTerrainCosts(const TArray<FFCWorldMapTerrainCost>& InCosts);
+
+	// --- Route costs --------------------------------------------------------
+
+	/** Money, risk and time charged for entering a cell (from its class and reveal state). */
+	void GetCellCosts_Global(int32 GlobalId, int32& OutMoney, int32& OutRisk) const;
+	void GetCellCosts_Global(int32 GlobalId, int32& OutMoney, int32& OutRisk, int32& OutTime) const;
+
+	/** Summed costs for a route (the start cell Path[0] is not charged); a gather-and-sum over the cost arrays. */
+	void ComputePathCosts(const TArray<int32>& Path, int32& OutMoney, int32& OutRisk) const;
+	void ComputePathCosts(const TArray<int32>& Path, int32& OutMoney, int32& OutRisk, int32& OutTime) const;
+
+	/** Search weight for entering a cell (money + risk). */
+	int32 GetStepCost_Global(int32 GlobalId) const { return CellStepCost[GlobalId]; }
+
+	/** Cheapest step cost of any class (at least 1); keeps the A* heuristics admissible. */
+	int32 GetMinStepCost() const { return MinStepCost; }
+
 	// --- Pathfinding --------------------------------------------------------
 
 	/**
@@ -72,11 +163,105 @@ public:
 	 * - Water cells are always traversable (revealed or not).
 	 * - Land cells require being revealed, except the goal cell may be unrevealed land.
 	 */
-	bool FindShortestPath_BFS(int32 StartGlobalId, int32 GoalGlobalId, TArray<int32>& OutPath) const;
+	bool FindShortestPath_BFS(int32 StartGlobalId, int32 GoalGlobalId, TArray<int32>& OutPath, FFCWorldMapPathStats* OutStats = nullptr) const;
 
-private:
+	/**
+	 * Find the cheapest path (by GetStepCost_Global) using A* over the 4-neighbourhood.
+	 * Same traversal rules as FindShortestPath_BFS. The frontier is a binary heap and the
+	 * heuristic is Manhattan distance * MinStepCost, so the returned route is optimal.
+	 */
+	bool FindCheapestPath_AStar(int32 StartGlobalId, int32 GoalGlobalId, TArray<int32>& OutPath, FFCWorldMapPathStats* OutStats = nullptr) const;
+
+	/**
+	 * Plan over the area graph first (entrances between the GridSize x GridSize areas),
+	 * then refine only the areas the route crosses. Rebuilds areas invalidated by
+	 * SetRevealed_Global/SetLandMask before searching. Routes are near-optimal.
+	 */
+	bool FindPath_Hierarchical(int32 StartGlobalId, int32 GoalGlobalId, TArray<int32>& OutPath, FFCWorldMapPathStats* OutStats = nullptr);
+
+	/**
+	 * Same as above without the refresh: requires RefreshHierarchy() after the last map change.
+	 * Safe to run concurrently on an immutable copy (used by the async preview route).
+	 */
+	bool FindPath_Hierarchical(int32 StartGlobalId, int32 GoalGlobalId, TArray<int32>& OutPath, FFCWorldMapPathStats* OutStats = nullptr) const;
+
+	/** Rebuild any invalidated areas of the hierarchy now (no-op when clean). */
+	void RefreshHierarchy() { Hierarchy.Refresh(*this); }
+
+	/**
+	 * Traversal rule shared by every planner:
+	 * water always, land only when revealed, the goal cell only when it is land.
+	 * Pass INDEX_NONE as GoalGlobalId for the goal-independent rule.
+	 */
 	bool IsTraversable_Global(int32 GlobalId, int32 GoalGlobalId) const;
 
-	TArray<uint8> RevealMask;
-	TArray<uint8> LandMask;
+	// --- Reachability -------------------------------------------------------
+
+	/**
+	 * True if any planner would find a route from StartGlobalId to GoalGlobalId.
+	 * Answered from the component labels without searching (constant time in practice).
+	 */
+	bool IsReachable_Global(int32 StartGlobalId, int32 GoalGlobalId) const;
+
+	/** Every cell that is a valid goal from StartGlobalId (land in or bordering the start component). */
+	void BuildReachableGoalMask(int32 StartGlobalId, FFCWorldMapBitMask& OutMask) const;
+
+	/** Per GridId: true if the area contains at least one valid goal from StartGlobalId. */
+	void BuildReachableAreas(int32 StartGlobalId, TBitArray<>& OutReachableGridIds) const;
+
+	const FFCWorldMapComponents& GetComponents() const { return Components; }
+
+private:
+
+	/** Walks a predecessor array (CameFrom[Start] == Start) from goal back to start. */
+	static bool ReconstructPath(const TArray<int32>& CameFrom, int32 StartGlobalId, int32 GoalGlobalId, TArray<int32>& OutPath);
+
+	/** Reveal-state write shared by SetRevealed_Global and the brush (no generation bump). */
+	bool SetRevealedInternal(int32 GlobalId, bool bRevealed);
+
+	/** Half-width of each disc row for a radius, indexed by (DY + Radius). */
+	static const TArray<int32>& GetDiscHalfWidths(int32 RadiusCells);
+
+	/** Sync TraversableMask (and the component labels) for one cell after a reveal change. */
+	void RefreshTraversable_Global(int32 GlobalId);
+
+	/** Recompute TraversableMask and the component labels from scratch. */
+	void RebuildTraversableMask();
+
+	/** Refresh the cost arrays of one cell after its reveal state changed. */
+	void RefreshCellCosts_Global(int32 GlobalId);
+
+	/** Refresh every cell's costs (class, table or mask replaced); derives classes from the land mask when there is no layer. */
+	void RebuildCellCosts();
+
+	/** Costs of one class, clamped to the cost arrays' range */
+	struct FClassCosts
+	{
+		uint16 Money = 1;
+		uint16 Risk = 1;
+		uint16 Time = 1;
+		uint16 UnrevealedRisk = 0;
+	};
+
+	FFCWorldMapBitMask RevealMask;
+	FFCWorldMapBitMask LandMask;
+	FFCWorldMapBitMask TraversableMask;
+
+	FFCWorldMapComponents Components;
+
+	TArray<uint8> TerrainClasses;
+	bool bHasTerrainClassLayer = false;
+
+	TArray<FClassCosts> ClassCosts;
+	int32 MinStepCost = 1;
+
+	/** Per-cell costs; CellStepCost = money + risk */
+	TArray<uint16> CellMoney;
+	TArray<uint16> CellRisk;
+	TArray<uint16> CellTime;
+	TArray<uint16> CellStepCost;
+
+	uint32 Generation = 0;
+
+	FFCWorldMapHierarchy Hierarchy;
 };
@@ -0,0 +1,655 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#include "WorldMap/FCWorldMapHierarchy.h"
+
+#include "Algo/Reverse.h"
+#include "WorldMap/FCWorldMapExploration.h"
+
+#include "Logging/LogMacros.h"
+#include "Expedition/FCExpeditionManager.h" // for LogFCWorldMap declaration
+
+namespace
+{
+	constexpr int32 AreaGridSize = FFCWorldMapExploration::GridSize;
+	constexpr int32 AreaSubSize = FFCWorldMapExploration::SubSize;
+	constexpr int32 MapGlobalSize = FFCWorldMapExploration::GlobalSize;
+
+	/** Runs at least this long get an entrance at each end instead of one in the middle. */
+	constexpr int32 EntranceSplitLength = 6;
+
+	int32 HierarchyHeuristic(int32 FromGlobalId, int32 ToGlobalId, int32 MinStepCost)
+	{
+		int32 FX, FY, TX, TY;
+		FFCWorldMapExploration::GlobalIdToXY(FromGlobalId, FX, FY);
+		FFCWorldMapExploration::GlobalIdToXY(ToGlobalId, TX, TY);
+		return (FMath::Abs(FX - TX) + FMath::Abs(FY - TY)) * MinStepCost;
+	}
+
+	bool AreCellsAdjacent(int32 A, int32 B)
+	{
+		int32 AX, AY, BX, BY;
+		FFCWorldMapExploration::GlobalIdToXY(A, AX, AY);
+		FFCWorldMapExploration::GlobalIdToXY(B, BX, BY);
+		return FMath::Abs(AX - BX) + FMath::Abs(AY - BY) == 1;
+	}
+}
+
+FFCWorldMapHierarchy::FFCWorldMapHierarchy()
+{
+	Areas.SetNum(AreaGridSize * AreaGridSize);
+	EastBorders.SetNum(AreaGridSize * (AreaGridSize - 1));
+	SouthBorders.SetNum((AreaGridSize - 1) * AreaGridSize);
+}
+
+void FFCWorldMapHierarchy::MarkAllDirty()
+{
+	for (FArea& Area : Areas)
+	{
+		Area.bDirty = true;
+	}
+	for (FBorder& Border : EastBorders)
+	{
+		Border.bDirty = true;
+	}
+	for (FBorder& Border : SouthBorders)
+	{
+		Border.bDirty = true;
+	}
+	bAnyDirty = true;
+}
+
+void FFCWorldMapHierarchy::MarkCellDirty(int32 GlobalId)
+{
+	if (!FFCWorldMapExploration::IsValidGlobalId(GlobalId))
+	{
+		return;
+	}
+
+	int32 GX, GY;
+	FFCWorldMapExploration::GlobalIdToXY(GlobalId, GX, GY);
+
+	const int32 AX = GX / AreaSubSize;
+	const int32 AY = GY / AreaSubSize;
+	const int32 SX = GX % AreaSubSize;
+	const int32 SY = GY % AreaSubSize;
+
+	Areas[FFCWorldMapExploration::XYToGridId(AX, AY)].bDirty = true;
+
+	// Border cells also change the entrances shared with the neighbouring area.
+	if (SX == AreaSubSize - 1 && AX < AreaGridSize - 1)
+	{
+		EastBorders[AY * (AreaGridSize - 1) + AX].bDirty = true;
+	}
+	if (SX == 0 && AX > 0)
+	{
+		EastBorders[AY * (AreaGridSize - 1) + AX - 1].bDirty = true;
+	}
+	if (SY == AreaSubSize - 1 && AY < AreaGridSize - 1)
+	{
+		SouthBorders[AY * AreaGridSize + AX].bDirty = true;
+	}
+	if (SY == 0 && AY > 0)
+	{
+		SouthBorders[(AY - 1) * AreaGridSize + AX].bDirty = true;
+	}
+
+	bAnyDirty = true;
+}
+
+void FFCWorldMapHierarchy::Refresh(const FFCWorldMapExploration& Map)
+{
+	if (!bAnyDirty)
+	{
+		return;
+	}
+
+	int32 RebuiltBorders = 0;
+	for (int32 Y = 0; Y < AreaGridSize; ++Y)
+	{
+		for (int32 X = 0; X < AreaGridSize; ++X)
+		{
+			const int32 GridId = FFCWorldMapExploration::XYToGridId(X, Y);
+
+			if (X < AreaGridSize - 1)
+			{
+				FBorder& Border = EastBorders[Y * (AreaGridSize - 1) + X];
+				if (Border.bDirty)
+				{
+					const int32 EastId = FFCWorldMapExploration::XYToGridId(X + 1, Y);
+					RebuildBorder(Map, Border, GridId, EastId, true);
+					Areas[GridId].bDirty = true;
+					Areas[EastId].bDirty = true;
+					++RebuiltBorders;
+				}
+			}
+
+			if (Y < AreaGridSize - 1)
+			{
+				FBorder& Border = SouthBorders[Y * AreaGridSize + X];
+				if (Border.bDirty)
+				{
+					const int32 SouthId = FFCWorldMapExploration::XYToGridId(X, Y + 1);
+					RebuildBorder(Map, Border, GridId, SouthId, false);
+					Areas[GridId].bDirty = true;
+					Areas[SouthId].bDirty = true;
+					++RebuiltBorders;
+				}
+			}
+		}
+	}
+
+	int32 RebuiltAreas = 0;
+	for (int32 GridId = 0; GridId < Areas.Num(); ++GridId)
+	{
+		if (Areas[GridId].bDirty)
+		{
+			RebuildArea(Map, GridId);
+			++RebuiltAreas;
+		}
+	}
+
+	bAnyDirty = false;
+
+	UE_LOG(LogFCWorldMap, Verbose, TEXT("FFCWorldMapHierarchy::Refresh: Rebuilt %d borders, %d areas (Nodes=%d)"),
+		RebuiltBorders, RebuiltAreas, GetNumAbstractNodes());
+}
+
+void FFCWorldMapHierarchy::RebuildBorder(const FFCWorldMapExploration& Map, FBorder& Border, int32 AreaA, int32 AreaB, bool bEastWest)
+{
+	Border.Transitions.Reset();
+
+	int32 AX, AY;
+	FFCWorldMapExploration::GridIdToXY(AreaA, AX, AY);
+
+	auto MakeTransition = [AX, AY, bEastWest](int32 Offset)
+	{
+		FTransition Transition;
+		if (bEastWest)
+		{
+			const int32 GX = AX * AreaSubSize + AreaSubSize - 1;
+			const int32 GY = AY * AreaSubSize + Offset;
+			Transition.CellA = FFCWorldMapExploration::XYToGlobalId(GX, GY);
+			Transition.CellB = FFCWorldMapExploration::XYToGlobalId(GX + 1, GY);
+		}
+		else
+		{
+			const int32 GX = AX * AreaSubSize + Offset;
+			const int32 GY = AY * AreaSubSize + AreaSubSize - 1;
+			Transition.CellA = FFCWorldMapExploration::XYToGlobalId(GX, GY);
+			Transition.CellB = FFCWorldMapExploration::XYToGlobalId(GX, GY + 1);
+		}
+		return Transition;
+	};
+
+	auto EmitRun = [&Border, &MakeTransition](int32 First, int32 Last)
+	{
+		if (Last - First + 1 >= EntranceSplitLength)
+		{
+			Border.Transitions.Add(MakeTransition(First));
+			Border.Transitions.Add(MakeTransition(Last));
+		}
+		else
+		{
+			Border.Transitions.Add(MakeTransition((First + Last) / 2));
+		}
+	};
+
+	int32 RunStart = INDEX_NONE;
+	for (int32 Offset = 0; Offset < AreaSubSize; ++Offset)
+	{
+		const FTransition Candidate = MakeTransition(Offset);
+		const bool bOpen = Map.IsTraversable_Global(Candidate.CellA, INDEX_NONE)
+			&& Map.IsTraversable_Global(Candidate.CellB, INDEX_NONE);
+
+		if (bOpen && RunStart == INDEX_NONE)
+		{
+			RunStart = Offset;
+		}
+		else if (!bOpen && RunStart != INDEX_NONE)
+		{
+			EmitRun(RunStart, Offset - 1);
+			RunStart = INDEX_NONE;
+		}
+	}
+
+	if (RunStart != INDEX_NONE)
+	{
+		EmitRun(RunStart, AreaSubSize - 1);
+	}
+
+	Border.bDirty = false;
+}
+
+void FFCWorldMapHierarchy::RebuildArea(const FFCWorldMapExploration& Map, int32 GridId)
+{
+	FArea& Area = Areas[GridId];
+	Area.NodeCells.Reset();
+	Area.InterLinks.Reset();
+
+	auto AddLink = [&Area, &Map](int32 Cell, int32 Partner)
+	{
+		int32 NodeIndex = Area.NodeCells.Find(Cell);
+		if (NodeIndex == INDEX_NONE)
+		{
+			NodeIndex = Area.NodeCells.Add(Cell);
+			Area.InterLinks.AddDefaulted();
+		}
+		Area.InterLinks[NodeIndex].Add(FInterLink{ Partner, Map.GetStepCost_Global(Partner) });
+	};
+
+	int32 AX, AY;
+	FFCWorldMapExploration::GridIdToXY(GridId, AX, AY);
+
+	if (AX < AreaGridSize - 1)
+	{
+		for (const FTransition& Transition : EastBorders[AY * (AreaGridSize - 1) + AX].Transitions)
+		{
+			AddLink(Transition.CellA, Transition.CellB);
+		}
+	}
+	if (AX > 0)
+	{
+		for (const FTransition& Transition : EastBorders[AY * (AreaGridSize - 1) + AX - 1].Transitions)
+		{
+			AddLink(Transition.CellB, Transition.CellA);
+		}
+	}
+	if (AY < AreaGridSize - 1)
+	{
+		for (const FTransition& Transition : SouthBorders[AY * AreaGridSize + AX].Transitions)
+		{
+			AddLink(Transition.CellA, Transition.CellB);
+		}
+	}
+	if (AY > 0)
+	{
+		for (const FTransition& Transition : SouthBorders[(AY - 1) * AreaGridSize + AX].Transitions)
+		{
+			AddLink(Transition.CellB, Transition.CellA);
+		}
+	}
+
+	const int32 NumNodes = Area.NodeCells.Num();
+	Area.IntraCost.Init(MAX_int32, NumNodes * NumNodes);
+
+	const FIntRect AreaRect = GetAreaCellRect(GridId);
+	FLocalSearch Search;
+	int32 Expanded = 0;
+
+	for (int32 From = 0; From < NumNodes; ++From)
+	{
+		RunLocalSearch(Map, AreaRect, Area.NodeCells[From], INDEX_NONE, false, INDEX_NONE, Search, Expanded);
+		for (int32 To = 0; To < NumNodes; ++To)
+		{
+			Area.IntraCost[From * NumNodes + To] = Search.GetCost(Area.NodeCells[To]);
+		}
+	}
+
+	Area.bDirty = false;
+}
+
+int32 FFCWorldMapHierarchy::FindNodeIndex(int32 GridId, int32 GlobalId) const
+{
+	return Areas[GridId].NodeCells.Find(GlobalId);
+}
+
+int32 FFCWorldMapHierarchy::GetNumAbstractNodes() const
+{
+	int32 Total = 0;
+	for (const FArea& Area : Areas)
+	{
+		Total += Area.NodeCells.Num();
+	}
+	return Total;
+}
+
+FIntRect FFCWorldMapHierarchy::GetAreaCellRect(int32 GridId)
+{
+	int32 AX, AY;
+	FFCWorldMapExploration::GridIdToXY(GridId, AX, AY);
+	const FIntPoint Min(AX * AreaSubSize, AY * AreaSubSize);
+	return FIntRect(Min, Min + FIntPoint(AreaSubSize, AreaSubSize));
+}
+
+bool FFCWorldMapHierarchy::FLocalSearch::Contains(int32 GX, int32 GY) const
+{
+	return GX >= CellRect.Min.X && GX < CellRect.Max.X && GY >= CellRect.Min.Y && GY < CellRect.Max.Y;
+}
+
+int32 FFCWorldMapHierarchy::FLocalSearch::LocalIndex(int32 GX, int32 GY) const
+{
+	return (GY - CellRect.Min.Y) * CellRect.Width() + (GX - CellRect.Min.X);
+}
+
+int32 FFCWorldMapHierarchy::FLocalSearch::GetCost(int32 GlobalId) const
+{
+	int32 GX, GY;
+	FFCWorldMapExploration::GlobalIdToXY(GlobalId, GX, GY);
+	return Contains(GX, GY) ? Cost[LocalIndex(GX, GY)] : MAX_int32;
+}
+
+int32 FFCWorldMapHierarchy::FLocalSearch::GetLink(int32 GlobalId) const
+{
+	int32 GX, GY;
+	FFCWorldMapExploration::GlobalIdToXY(GlobalId, GX, GY);
+	return Contains(GX, GY) ? Link[LocalIndex(GX, GY)] : INDEX_NONE;
+}
+
+void FFCWorldMapHierarchy::RunLocalSearch(const FFCWorldMapExploration& Map, const FIntRect& CellRect, int32 SourceGlobalId, int32 GoalRuleGlobalId, bool bBackward, int32 StopAtGlobalId, FLocalSearch& Out, int32& InOutExpanded)
+{
+	Out.CellRect = CellRect;
+	const int32 CellCount = CellRect.Area();
+	Out.Cost.Init(MAX_int32, CellCount);
+	Out.Link.Init(INDEX_NONE, CellCount);
+
+	int32 SX, SY;
+	FFCWorldMapExploration::GlobalIdToXY(SourceGlobalId, SX, SY);
+	if (!Out.Contains(SX, SY))
+	{
+		return;
+	}
+
+	struct FOpenNode
+	{
+		int32 GlobalId;
+		int32 Cost;
+	};
+
+	auto OpenLess = [](const FOpenNode& A, const FOpenNode& B)
+	{
+		return A.Cost < B.Cost;
+	};
+
+	TArray<FOpenNode> Open;
+	Open.Reserve(64);
+
+	const int32 SourceIndex = Out.LocalIndex(SX, SY);
+	Out.Cost[SourceIndex] = 0;
+	Out.Link[SourceIndex] = SourceGlobalId;
+	Open.HeapPush(FOpenNode{ SourceGlobalId, 0 }, OpenLess);
+
+	while (Open.Num() > 0)
+	{
+		FOpenNode Current;
+		Open.HeapPop(Current, OpenLess, EAllowShrinking::No);
+
+		int32 X, Y;
+		FFCWorldMapExploration::GlobalIdToXY(Current.GlobalId, X, Y);
+		if (Current.Cost > Out.Cost[Out.LocalIndex(X, Y)])
+		{
+			continue;
+		}
+
+		++InOutExpanded;
+
+		if (Current.GlobalId == StopAtGlobalId)
+		{
+			break;
+		}
+
+		const int32 NeighborX[4] = { X + 1, X - 1, X,     X };
+		const int32 NeighborY[4] = { Y,     Y,     Y + 1, Y - 1 };
+
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			const int32 NX = NeighborX[Index];
+			const int32 NY = NeighborY[Index];
+			if (!Out.Contains(NX, NY))
+			{
+				continue;
+			}
+
+			const int32 NeighborId = FFCWorldMapExploration::XYToGlobalId(NX, NY);
+			if (!Map.IsTraversable_Global(NeighborId, GoalRuleGlobalId))
+			{
+				continue;
+			}
+
+			// Backward searches walk edges in reverse, so the entered cell is the current one.
+			const int32 StepCost = bBackward ? Map.GetStepCost_Global(Current.GlobalId) : Map.GetStepCost_Global(NeighborId);
+			const int32 NewCost = Current.Cost + StepCost;
+			const int32 NeighborIndex = Out.LocalIndex(NX, NY);
+			if (NewCost >= Out.Cost[NeighborIndex])
+			{
+				continue;
+			}
+
+			Out.Cost[NeighborIndex] = NewCost;
+			Out.Link[NeighborIndex] = Current.GlobalId;
+			Open.HeapPush(FOpenNode{ NeighborId, NewCost }, OpenLess);
+		}
+	}
+}
+
+bool FFCWorldMapHierarchy::FindPath(const FFCWorldMapExploration& Map, int32 StartGlobalId, int32 GoalGlobalId, TArray<int32>& OutPath, FFCWorldMapPathStats* OutStats) const
+{
+	OutPath.Reset();
+	if (OutStats)
+	{
+		*OutStats = FFCWorldMapPathStats();
+	}
+
+	if (!FFCWorldMapExploration::IsValidGlobalId(StartGlobalId) || !FFCWorldMapExploration::IsValidGlobalId(GoalGlobalId))
+	{
+		UE_LOG(LogFCWorldMap, Warning, TEXT("FFCWorldMapHierarchy::FindPath: Invalid Start(%d) or Goal(%d)"), StartGlobalId, GoalGlobalId);
+		return false;
+	}
+
+	if (!Map.IsTraversable_Global(StartGlobalId, GoalGlobalId) || !Map.IsTraversable_Global(GoalGlobalId, GoalGlobalId))
+	{
+		UE_LOG(LogFCWorldMap, Warning, TEXT("FFCWorldMapHierarchy::FindPath: Start %d or Goal %d not traversable"), StartGlobalId, GoalGlobalId);
+		return false;
+	}
+
+	ensureMsgf(!bAnyDirty, TEXT("FFCWorldMapHierarchy::FindPath called before Refresh()"));
+
+	int32 Expanded = 0;
+
+	int32 StartArea, StartSub;
+	FFCWorldMapExploration::GlobalIdToAreaSub(StartGlobalId, StartArea, StartSub);
+
+	int32 GoalArea, GoalSub;
+	FFCWorldMapExploration::GlobalIdToAreaSub(GoalGlobalId, GoalArea, GoalSub);
+
+	// 1) Connect the start to the entrances of its area.
+	FLocalSearch StartSearch;
+	RunLocalSearch(Map, GetAreaCellRect(StartArea), StartGlobalId, GoalGlobalId, false, INDEX_NONE, StartSearch, Expanded);
+
+	// 2) Connect the goal (backwards). The goal may be unrevealed land, which is never an entrance,
+	//    so also cover the neighbouring areas when the goal sits on an area border.
+	FIntRect GoalRect = GetAreaCellRect(GoalArea);
+	{
+		int32 GX, GY;
+		FFCWorldMapExploration::GlobalIdToXY(GoalGlobalId, GX, GY);
+		if (GX == GoalRect.Min.X && GoalRect.Min.X > 0)                     { GoalRect.Min.X -= AreaSubSize; }
+		if (GX == GoalRect.Max.X - 1 && GoalRect.Max.X < MapGlobalSize)    { GoalRect.Max.X += AreaSubSize; }
+		if (GY == GoalRect.Min.Y && GoalRect.Min.Y > 0)                     { GoalRect.Min.Y -= AreaSubSize; }
+		if (GY == GoalRect.Max.Y - 1 && GoalRect.Max.Y < MapGlobalSize)    { GoalRect.Max.Y += AreaSubSize; }
+	}
+
+	FLocalSearch GoalSearch;
+	RunLocalSearch(Map, GoalRect, GoalGlobalId, GoalGlobalId, true, INDEX_NONE, GoalSearch, Expanded);
+
+	// 3) A* over the entrance graph (keyed by global cell id).
+	struct FAbstractEntry
+	{
+		int32 GScore = MAX_int32;
+		int32 Parent = INDEX_NONE;
+	};
+
+	struct FOpenNode
+	{
+		int32 GlobalId;
+		int32 GScore;
+		int32 FScore;
+	};
+
+	auto OpenLess = [](const FOpenNode& A, const FOpenNode& B)
+	{
+		return A.FScore < B.FScore || (A.FScore == B.FScore && A.GScore > B.GScore);
+	};
+
+	TMap<int32, FAbstractEntry> Entries;
+	Entries.Reserve(256);
+
+	TArray<FOpenNode> Open;
+	Open.Reserve(256);
+
+	auto Relax = [&](int32 FromId, int32 FromG, int32 ToId, int32 EdgeCost)
+	{
+		if (EdgeCost == MAX_int32)
+		{
+			return;
+		}
+
+		const int32 NewG = FromG + EdgeCost;
+		FAbstractEntry& Entry = Entries.FindOrAdd(ToId);
+		if (NewG >= Entry.GScore)
+		{
+			return;
+		}
+
+		Entry.GScore = NewG;
+		Entry.Parent = FromId;
+		Open.HeapPush(FOpenNode{ ToId, NewG, NewG + HierarchyHeuristic(ToId, GoalGlobalId, Map.GetMinStepCost()) }, OpenLess);
+	};
+
+	Entries.Add(StartGlobalId, FAbstractEntry{ 0, StartGlobalId });
+	Open.HeapPush(FOpenNode{ StartGlobalId, 0, HierarchyHeuristic(StartGlobalId, GoalGlobalId, Map.GetMinStepCost()) }, OpenLess);
+
+	bool bFound = false;
+
+	while (Open.Num() > 0)
+	{
+		FOpenNode Current;
+		Open.HeapPop(Current, OpenLess, EAllowShrinking::No);
+
+		if (Current.GScore > Entries.FindChecked(Current.GlobalId).GScore)
+		{
+			continue;
+		}
+
+		++Expanded;
+
+		if (Current.GlobalId == GoalGlobalId)
+		{
+			bFound = true;
+			break;
+		}
+
+		// Anything inside the goal search region can finish directly.
+		Relax(Current.GlobalId, Current.GScore, GoalGlobalId, GoalSearch.GetCost(Current.GlobalId));
+
+		if (Current.GlobalId == StartGlobalId)
+		{
+			for (const int32 NodeCell : Areas[StartArea].NodeCells)
+			{
+				Relax(StartGlobalId, 0, NodeCell, StartSearch.GetCost(NodeCell));
+			}
+		}
+
+		int32 CellArea, CellSub;
+		FFCWorldMapExploration::GlobalIdToAreaSub(Current.GlobalId, CellArea, CellSub);
+
+		const int32 NodeIndex = FindNodeIndex(CellArea, Current.GlobalId);
+		if (NodeIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const FArea& Area = Areas[CellArea];
+		const int32 NumNodes = Area.NodeCells.Num();
+
+		for (int32 Other = 0; Other < NumNodes; ++Other)
+		{
+			if (Other != NodeIndex)
+			{
+				Relax(Current.GlobalId, Current.GScore, Area.NodeCells[Other], Area.IntraCost[NodeIndex * NumNodes + Other]);
+			}
+		}
+
+		for (const FInterLink& Link : Area.InterLinks[NodeIndex])
+		{
+			Relax(Current.GlobalId, Current.GScore, Link.Cell, Link.Cost);
+		}
+	}
+
+	if (!bFound)
+	{
+		UE_LOG(LogFCWorldMap, Warning, TEXT("FFCWorldMapHierarchy::FindPath: No abstract route from %d to %d"), StartGlobalId, GoalGlobalId);
+		return false;
+	}
+
+	TArray<int32> Waypoints;
+	for (int32 Cell = GoalGlobalId; Cell != StartGlobalId; Cell = Entries.FindChecked(Cell).Parent)
+	{
+		Waypoints.Add(Cell);
+	}
+	Waypoints.Add(StartGlobalId);
+	Algo::Reverse(Waypoints);
+
+	// 4) Refine each abstract edge into cells; only areas on the route are searched again.
+	OutPath.Add(StartGlobalId);
+
+	FLocalSearch SegmentSearch;
+	TArray<int32> Segment;
+
+	for (int32 Index = 0; Index + 1 < Waypoints.Num(); ++Index)
+	{
+		const int32 From = Waypoints[Index];
+		const int32 To = Waypoints[Index + 1];
+
+		if (To == GoalGlobalId)
+		{
+			for (int32 Cell = From; Cell != GoalGlobalId;)
+			{
+				Cell = GoalSearch.GetLink(Cell);
+				if (Cell == INDEX_NONE)
+				{
+					OutPath.Reset();
+					return false;
+				}
+				OutPath.Add(Cell);
+			}
+			continue;
+		}
+
+		if (AreCellsAdjacent(From, To))
+		{
+			OutPath.Add(To);
+			continue;
+		}
+
+		const FLocalSearch* LinkSource = &StartSearch;
+		if (From != StartGlobalId)
+		{
+			int32 FromArea, FromSub;
+			FFCWorldMapExploration::GlobalIdToAreaSub(From, FromArea, FromSub);
+			RunLocalSearch(Map, GetAreaCellRect(FromArea), From, INDEX_NONE, false, To, SegmentSearch, Expanded);
+			LinkSource = &SegmentSearch;
+		}
+
+		Segment.Reset();
+		for (int32 Cell = To; Cell != From; Cell = LinkSource->GetLink(Cell))
+		{
+			if (Cell == INDEX_NONE)
+			{
+				OutPath.Reset();
+				return false;
+			}
+			Segment.Add(Cell);
+		}
+		Algo::Reverse(Segment);
+		OutPath.Append(Segment);
+	}
+
+	if (OutStats)
+	{
+		OutStats->NodesExpanded = Expanded;
+		OutStats->PathCost = Entries.FindChecked(GoalGlobalId).GScore;
+	}
+
+	UE_LOG(LogFCWorldMap, Verbose, TEXT("FFCWorldMapHierarchy::FindPath: %d waypoints -> %d cells (Expanded=%d)"),
+		Waypoints.Num(), OutPath.Num(), Expanded);
+	return true;
+}
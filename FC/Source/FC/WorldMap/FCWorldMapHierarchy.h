@@ -0,0 +1,120 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FFCWorldMapExploration;
+struct FFCWorldMapPathStats;
+
+/**
+ * FFCWorldMapHierarchy is the HPA*-style abstraction over the world-map areas.
+ * - Entrances are placed on every run of traversable cell pairs along the border
+ *   between two neighbouring areas (one in the middle, or one at each end for long runs).
+ * - Each area caches the cheapest in-area cost between all of its entrance cells.
+ * - Queries plan over the entrance graph first, then refine only the areas the route crosses.
+ * - Cell changes invalidate only the owning area (plus the borders the cell lies on).
+ */
+class FFCWorldMapHierarchy
+{
+public:
+	FFCWorldMapHierarchy();
+
+	/** Invalidate every area and border (e.g. a new land mask was applied wholesale). */
+	void MarkAllDirty();
+
+	/** Invalidate the area owning GlobalId and any border the cell sits on. */
+	void MarkCellDirty(int32 GlobalId);
+
+	/** True if any area or border needs rebuilding before the next query. */
+	bool IsDirty() const { return bAnyDirty; }
+
+	/** Rebuild dirty borders and areas from the current map state. */
+	void Refresh(const FFCWorldMapExploration& Map);
+
+	/**
+	 * Plan a route over the abstract graph and refine it to global cells.
+	 * Requires Refresh() after the last map change. Same traversal rules as the flat planners.
+	 */
+	bool FindPath(const FFCWorldMapExploration& Map, int32 StartGlobalId, int32 GoalGlobalId, TArray<int32>& OutPath, FFCWorldMapPathStats* OutStats) const;
+
+	/** Total entrance cells across all areas (for diagnostics). */
+	int32 GetNumAbstractNodes() const;
+
+private:
+	/** A pair of traversable cells facing each other across an area border. */
+	struct FTransition
+	{
+		int32 CellA = INDEX_NONE; // west/north side
+		int32 CellB = INDEX_NONE; // east/south side
+	};
+
+	struct FBorder
+	{
+		TArray<FTransition> Transitions;
+		bool bDirty = true;
+	};
+
+	/** Link from an entrance cell to its partner cell in the neighbouring area. */
+	struct FInterLink
+	{
+		int32 Cell = INDEX_NONE;
+		int32 Cost = 0;
+	};
+
+	struct FArea
+	{
+		/** Entrance cells inside this area (global ids, unique) */
+		TArray<int32> NodeCells;
+
+		/** Per node: partner cells across the area border */
+		TArray<TArray<FInterLink>> InterLinks;
+
+		/** NodeCells.Num()^2 cheapest in-area costs (MAX_int32 when unreachable) */
+		TArray<int32> IntraCost;
+
+		bool bDirty = true;
+	};
+
+	/** Result of a Dijkstra search restricted to a rectangle of global cells. */
+	struct FLocalSearch
+	{
+		FIntRect CellRect;
+
+		/** Cost per local cell (MAX_int32 when unreached) */
+		TArray<int32> Cost;
+
+		/** Predecessor (forward) or successor towards the source (backward), as global ids */
+		TArray<int32> Link;
+
+		bool Contains(int32 GX, int32 GY) const;
+		int32 LocalIndex(int32 GX, int32 GY) const;
+		int32 GetCost(int32 GlobalId) const;
+		int32 GetLink(int32 GlobalId) const;
+	};
+
+	static FIntRect GetAreaCellRect(int32 GridId);
+
+	/**
+	 * Dijkstra from SourceGlobalId over the cells in CellRect.
+	 * Forward: Cost = cost to reach each cell from the source.
+	 * Backward: Cost = cost to reach the source from each cell (source is the goal).
+	 * Stops early when StopAtGlobalId is settled (INDEX_NONE = flood the whole rect).
+	 */
+	static void RunLocalSearch(const FFCWorldMapExploration& Map, const FIntRect& CellRect, int32 SourceGlobalId, int32 GoalRuleGlobalId, bool bBackward, int32 StopAtGlobalId, FLocalSearch& Out, int32& InOutExpanded);
+
+	void RebuildBorder(const FFCWorldMapExploration& Map, FBorder& Border, int32 AreaA, int32 AreaB, bool bEastWest);
+	void RebuildArea(const FFCWorldMapExploration& Map, int32 GridId);
+
+	int32 FindNodeIndex(int32 GridId, int32 GlobalId) const;
+
+	/** Border between area (X, Y) and (X + 1, Y); index = Y * (GridSize - 1) + X */
+	TArray<FBorder> EastBorders;
+
+	/** Border between area (X, Y) and (X, Y + 1); index = Y * GridSize + X */
+	TArray<FBorder> SouthBorders;
+
+	TArray<FArea> Areas;
+
+	bool bAnyDirty = true;
+};
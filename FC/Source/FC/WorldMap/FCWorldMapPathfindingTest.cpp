@@ -0,0 +1,198 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/UFCGameInstance.h"
+#include "Engine/Texture2D.h"
+#include "Expedition/FCExpeditionManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/ConfigCacheIni.h"
+#include "WorldMap/FCWorldMapAlternativeRoutes.h"
+#include "WorldMap/FCWorldMapExploration.h"
+
+/**
+ * FC.WorldMap.Pathfinding
+ *
+ * Runs BFS, A* and a plain Dijkstra reference over the project's land mask (fully revealed, so
+ * land is traversable and water is the expensive class) for a fixed set of start/goal pairs.
+ * A* has to return the Dijkstra optimum, never cost more than the BFS route, and expand fewer
+ * cells than BFS. FFCWorldMapAlternativeRoutes (default settings) runs on the same pairs; its first
+ * route must match the optimum, and its expansions (bounded backward pass included) are logged
+ * next to A*'s.
+ */
+namespace FCWorldMapPathfindingTest
+{
+	constexpr int32 NumPairs = 8;
+
+	/** Pairs closer than this (Manhattan, cells) say little about search effort */
+	constexpr int32 MinPairDistance = 48;
+
+	/** Land mask of the configured game instance; false (all land) if it cannot be loaded */
+	bool LoadProjectLandMask(TArray<uint8>& OutLandMask)
+	{
+		FString GameInstanceClassPath;
+		GConfig->GetString(TEXT("/Script/EngineSettings.GameMapsSettings"), TEXT("GameInstanceClass"), GameInstanceClassPath, GEngineIni);
+
+		const UClass* GameInstanceClass = FSoftClassPath(GameInstanceClassPath).TryLoadClass<UFCGameInstance>();
+		const UFCGameInstance* GameInstance = GameInstanceClass ? GameInstanceClass->GetDefaultObject<UFCGameInstance>() : nullptr;
+		UTexture2D* Texture = GameInstance ? GameInstance->WorldMapLandMaskTexture.LoadSynchronous() : nullptr;
+		return UFCExpeditionManager::ReadLandMaskTexture(Texture, OutLandMask);
+	}
+
+	/** Reference search: uniform-cost (no heuristic), same traversal rule and step costs as the planners */
+	int32 DijkstraCost(const FFCWorldMapExploration& WorldMap, int32 StartGlobalId, int32 GoalGlobalId)
+	{
+		struct FEntry
+		{
+			int32 Cost;
+			int32 GlobalId;
+			bool operator<(const FEntry& Other) const { return Cost < Other.Cost; }
+		};
+
+		TArray<int32> Best;
+		Best.Init(MAX_int32, FFCWorldMapExploration::GlobalCount);
+		Best[StartGlobalId] = 0;
+
+		TArray<FEntry> Heap;
+		Heap.HeapPush(FEntry{ 0, StartGlobalId });
+
+		while (Heap.Num() > 0)
+		{
+			FEntry Current;
+			Heap.HeapPop(Current, EAllowShrinking::No);
+			if (Current.Cost > Best[Current.GlobalId])
+			{
+				continue;
+			}
+			if (Current.GlobalId == GoalGlobalId)
+			{
+				return Current.Cost;
+			}
+
+			int32 X, Y;
+			FFCWorldMapExploration::GlobalIdToXY(Current.GlobalId, X, Y);
+			const int32 NeighborX[4] = { X + 1, X - 1, X,     X };
+			const int32 NeighborY[4] = { Y,     Y,     Y + 1, Y - 1 };
+
+			for (int32 Index = 0; Index < 4; ++Index)
+			{
+				if (!FFCWorldMapExploration::IsValidGlobal(NeighborX[Index], NeighborY[Index]))
+				{
+					continue;
+				}
+				const int32 NeighborId = FFCWorldMapExploration::XYToGlobalId(NeighborX[Index], NeighborY[Index]);
+				if (!WorldMap.IsTraversable_Global(NeighborId, GoalGlobalId))
+				{
+					continue;
+				}
+				const int32 Cost = Current.Cost + WorldMap.GetStepCost_Global(NeighborId);
+				if (Cost < Best[NeighborId])
+				{
+					Best[NeighborId] = Cost;
+					Heap.HeapPush(FEntry{ Cost, NeighborId });
+				}
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	/** Deterministic land-to-land pairs in the same component, at least MinPairDistance apart */
+	void PickPairs(const FFCWorldMapExploration& WorldMap, TArray<TPair<int32, int32>>& OutPairs)
+	{
+		FRandomStream Random(1);
+		for (int32 Attempt = 0; Attempt < 10000 && OutPairs.Num() < NumPairs; ++Attempt)
+		{
+			const int32 Start = Random.RandHelper(FFCWorldMapExploration::GlobalCount);
+			const int32 Goal = Random.RandHelper(FFCWorldMapExploration::GlobalCount);
+			if (!WorldMap.IsLand_Global(Start) || !WorldMap.IsLand_Global(Goal) || !WorldMap.IsReachable_Global(Start, Goal))
+			{
+				continue;
+			}
+
+			int32 StartX, StartY, GoalX, GoalY;
+			FFCWorldMapExploration::GlobalIdToXY(Start, StartX, StartY);
+			FFCWorldMapExploration::GlobalIdToXY(Goal, GoalX, GoalY);
+			if (FMath::Abs(StartX - GoalX) + FMath::Abs(StartY - GoalY) >= MinPairDistance)
+			{
+				OutPairs.Emplace(Start, Goal);
+			}
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFCWorldMapPathfindingTest, "FC.WorldMap.Pathfinding",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFCWorldMapPathfindingTest::RunTest(const FString& Parameters)
+{
+	using namespace FCWorldMapPathfindingTest;
+
+	TArray<uint8> LandMask;
+	if (!LoadProjectLandMask(LandMask))
+	{
+		AddError(TEXT("Could not load the game instance's WorldMapLandMaskTexture"));
+		return false;
+	}
+
+	FFCWorldMapExploration WorldMap;
+	WorldMap.SetLandMask(LandMask);
+	WorldMap.SetRevealMask(FFCWorldMapBitMask(FFCWorldMapExploration::GlobalSize, FFCWorldMapExploration::GlobalSize, true));
+
+	TArray<TPair<int32, int32>> Pairs;
+	PickPairs(WorldMap, Pairs);
+	if (!TestEqual(TEXT("start/goal pairs found on the land mask"), Pairs.Num(), NumPairs))
+	{
+		return false;
+	}
+
+	FFCWorldMapAlternativeRoutes Alternatives;
+	TArray<FFCWorldMapRouteOption> Routes;
+
+	int64 TotalBFSExpanded = 0;
+	int64 TotalAStarExpanded = 0;
+	int64 TotalAlternativesExpanded = 0;
+	for (const TPair<int32, int32>& Pair : Pairs)
+	{
+		const FString What = FString::Printf(TEXT("%d -> %d"), Pair.Key, Pair.Value);
+
+		TArray<int32> BFSPath;
+		TArray<int32> AStarPath;
+		FFCWorldMapPathStats BFSStats;
+		FFCWorldMapPathStats AStarStats;
+		const bool bBFS = WorldMap.FindShortestPath_BFS(Pair.Key, Pair.Value, BFSPath, &BFSStats);
+		const bool bAStar = WorldMap.FindCheapestPath_AStar(Pair.Key, Pair.Value, AStarPath, &AStarStats);
+		const int32 OptimalCost = DijkstraCost(WorldMap, Pair.Key, Pair.Value);
+
+		if (!TestTrue(What + TEXT(": BFS finds a path"), bBFS) || !TestTrue(What + TEXT(": A* finds a path"), bAStar))
+		{
+			continue;
+		}
+
+		TestEqual(What + TEXT(": A* cost is the Dijkstra optimum"), AStarStats.PathCost, OptimalCost);
+		TestTrue(What + TEXT(": A* cost <= BFS cost"), AStarStats.PathCost <= BFSStats.PathCost);
+		TestTrue(What + TEXT(": A* expands fewer cells than BFS"), AStarStats.NodesExpanded < BFSStats.NodesExpanded);
+
+		const int32 NumRoutes = Alternatives.Find(WorldMap, Pair.Key, Pair.Value, FFCWorldMapAlternativeRoutes::FSettings(), Routes);
+		if (TestTrue(What + TEXT(": alternative routes found"), NumRoutes > 0))
+		{
+			TestEqual(What + TEXT(": first alternative route is the optimum"), Routes[0].MoneyCost + Routes[0].RiskCost, OptimalCost);
+		}
+
+		AddInfo(FString::Printf(TEXT("%s: BFS %d cells / cost %d, A* %d cells / cost %d, optimum %d, %d alternatives %d cells"),
+			*What, BFSStats.NodesExpanded, BFSStats.PathCost, AStarStats.NodesExpanded, AStarStats.PathCost, OptimalCost,
+			NumRoutes, Alternatives.GetLastNodesExpanded()));
+
+		TotalBFSExpanded += BFSStats.NodesExpanded;
+		TotalAStarExpanded += AStarStats.NodesExpanded;
+		TotalAlternativesExpanded += Alternatives.GetLastNodesExpanded();
+	}
+
+	AddInfo(FString::Printf(TEXT("Expanded over %d pairs: BFS %lld, A* %lld, alternatives %lld"),
+		Pairs.Num(), TotalBFSExpanded, TotalAStarExpanded, TotalAlternativesExpanded));
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,17 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#include "WorldMap/FCWorldMapStats.h"
+
+DEFINE_STAT(STAT_FCWorldMap_RouteCacheHits);
+DEFINE_STAT(STAT_FCWorldMap_RouteCacheMisses);
+DEFINE_STAT(STAT_FCWorldMap_RouteCacheEntries);
+
+DEFINE_STAT(STAT_FCWorldMap_TextureUploadCommands);
+DEFINE_STAT(STAT_FCWorldMap_TextureUploadRegions);
+DEFINE_STAT(STAT_FCWorldMap_TextureUploadBytes);
+DEFINE_STAT(STAT_FCWorldMap_TextureFullUploads);
+DEFINE_STAT(STAT_FCWorldMap_DistanceField);
+
+DEFINE_STAT(STAT_FCWorldMap_RouteRisk);
+
+DEFINE_STAT(STAT_FCWorldMap_Save);
@@ -0,0 +1,30 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+/**
+ * Stat group for world-map planning, texture streaming and exploration saves.
+ * View in game with "stat FCWorldMap".
+ */
+DECLARE_STATS_GROUP(TEXT("FCWorldMap"), STATGROUP_FCWorldMap, STATCAT_Advanced);
+
+// --- Route cache (running totals) -------------------------------------------
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Route Cache Hits"), STAT_FCWorldMap_RouteCacheHits, STATGROUP_FCWorldMap, FC_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Route Cache Misses"), STAT_FCWorldMap_RouteCacheMisses, STATGROUP_FCWorldMap, FC_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Route Cache Entries"), STAT_FCWorldMap_RouteCacheEntries, STATGROUP_FCWorldMap, FC_API);
+
+// --- Mask texture uploads (per frame) ---------------------------------------
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Texture Upload Commands"), STAT_FCWorldMap_TextureUploadCommands, STATGROUP_FCWorldMap, FC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Texture Upload Regions"), STAT_FCWorldMap_TextureUploadRegions, STATGROUP_FCWorldMap, FC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Texture Upload Bytes"), STAT_FCWorldMap_TextureUploadBytes, STATGROUP_FCWorldMap, FC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Texture Full Uploads"), STAT_FCWorldMap_TextureFullUploads, STATGROUP_FCWorldMap, FC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Fog Distance Field"), STAT_FCWorldMap_DistanceField, STATGROUP_FCWorldMap, FC_API);
+
+// --- Route risk simulation --------------------------------------------------
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Route Risk Simulation"), STAT_FCWorldMap_RouteRisk, STATGROUP_FCWorldMap, FC_API);
+
+// --- Exploration save -------------------------------------------------------
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Exploration Save"), STAT_FCWorldMap_Save, STATGROUP_FCWorldMap, FC_API);
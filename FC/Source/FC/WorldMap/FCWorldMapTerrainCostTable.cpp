@@ -0,0 +1,3 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#include "WorldMap/FCWorldMapTerrainCostTable.h"
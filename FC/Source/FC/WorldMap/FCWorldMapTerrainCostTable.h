@@ -0,0 +1,45 @@
+// Copyright Slomotion Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "FCWorldMapTerrainCostTable.generated.h"
+
+/** What entering one cell of a terrain class costs an expedition */
+USTRUCT(BlueprintType)
+struct FFCWorldMapTerrainCost
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Terrain")
+	FName Name;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Terrain", meta = (ClampMin = "0", ClampMax = "1000"))
+	int32 Money = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Terrain", meta = (ClampMin = "0", ClampMax = "1000"))
+	int32 Risk = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Terrain", meta = (ClampMin = "0", ClampMax = "1000"))
+	int32 Time = 1;
+
+	/** Added to Risk while the cell is still unrevealed */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Terrain", meta = (ClampMin = "0", ClampMax = "1000"))
+	int32 UnrevealedRisk = 0;
+};
+
+/**
+ * Route costs per world map terrain class. Entry N applies to cells whose terrain-class
+ * byte is N (UFCGameInstance::WorldMapTerrainClassTexture); classes past the end use entry 0.
+ * Without a terrain-class texture, land cells are class 0 and water cells class 1.
+ */
+UCLASS(BlueprintType)
+class FC_API UFCWorldMapTerrainCostTable : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Terrain")
+	TArray<FFCWorldMapTerrainCost> Classes;
+};